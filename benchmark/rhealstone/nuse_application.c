@@ -0,0 +1,285 @@
+#include "nuse.h"
+#include "nuse_data.h"
+
+/*************************************************************************
+*
+*   Rhealstone-style kernel benchmark
+*   bench_main() times each kernel operation with NUSE_CYCLE_COUNTER() and
+*   bench_partner() supplies the other half of the ping-pong tests
+*   Results are written as CSV text to bench_results[]; bench_done is set
+*   when the run is complete
+*
+*************************************************************************/
+
+#define BENCH_ITERATIONS    1000        /* operations timed by each test */
+#define BENCH_TICKS         100         /* clock ticks sampled by the interrupt latency test */
+
+#define BENCH_PARTNER       0           /* task indices - partner has the highest priority */
+#define BENCH_MAIN          1
+#define BENCH_IDLE          2
+
+#define BENCH_GO            0           /* semaphore - starts the partner on each test */
+#define BENCH_PING          1           /* semaphores - shuffled between the two tasks */
+#define BENCH_PONG          2
+
+#if NUSE_SCHEDULER_TYPE == NUSE_PRIORITY_SCHEDULER
+    #define BENCH_SCHEDULER "priority"
+#elif NUSE_SCHEDULER_TYPE == NUSE_ROUND_ROBIN_SCHEDULER
+    #define BENCH_SCHEDULER "round_robin"
+#elif NUSE_SCHEDULER_TYPE == NUSE_TIME_SLICE_SCHEDULER
+    #define BENCH_SCHEDULER "time_slice"
+#else
+    #error Rhealstone benchmark needs a scheduler which allows tasks to block
+#endif
+
+char bench_results[1024];               /* CSV results - read out by debugger or copied to a UART */
+U16 bench_length;
+volatile U8 bench_done;
+
+volatile U32 bench_set_time;            /* event group test - time at which the flag was set */
+U32 bench_wake_total;                   /* event group test - accumulated by the partner */
+
+
+void bench_append(char *text)
+{
+    while ((*text != '\0') && (bench_length < sizeof(bench_results) - 1))
+        bench_results[bench_length++] = *text++;
+
+    bench_results[bench_length] = '\0';
+}
+
+void bench_number(U32 value)
+{
+    char digits[11];
+    U8 i;
+
+    i = sizeof(digits) - 1;
+    digits[i] = '\0';
+    do
+    {
+        digits[--i] = '0' + (char)(value % 10);
+        value /= 10;
+    } while (value != 0);
+
+    bench_append(&digits[i]);
+}
+
+void bench_report(char *test, char *statistic, U32 count, U32 cycles)
+{
+    bench_append(BENCH_SCHEDULER ",");
+    bench_append(test);
+    bench_append(",");
+    bench_append(statistic);
+    bench_append(",");
+    bench_number(count);
+    bench_append(",");
+    bench_number(cycles);
+    bench_append("\n");
+}
+
+void bench_latency(char *test, U8 latency)
+{
+    U32 counts[NUSE_HISTOGRAM_BUCKETS], worst, bound, samples;
+    U8 b;
+
+    NUSE_Latency_Histogram(latency, counts, &worst);
+    samples = 0;
+    for (b=0; b<NUSE_HISTOGRAM_BUCKETS; b++)
+        samples += counts[b];
+
+    NUSE_Latency_Percentile(latency, 50, &bound);
+    bench_report(test, "p50", samples, bound);
+    NUSE_Latency_Percentile(latency, 99, &bound);
+    bench_report(test, "p99", samples, bound);
+    bench_report(test, "max", samples, worst);
+}
+
+
+void bench_partner(void)
+{
+    volatile U16 i;
+    ADDR message;
+    U8 data[4], size;
+    NUSE_EVENT_FLAGS flags;
+
+    /* task switch or preemption */
+
+    NUSE_Semaphore_Obtain(BENCH_GO, NUSE_SUSPEND);
+    for (i=0; i<BENCH_ITERATIONS; i++)
+    {
+        #if NUSE_SCHEDULER_TYPE == NUSE_PRIORITY_SCHEDULER
+            NUSE_Task_Suspend(BENCH_PARTNER);
+        #else
+            NUSE_Task_Relinquish();
+        #endif
+    }
+
+    /* semaphore shuffle */
+
+    NUSE_Semaphore_Obtain(BENCH_GO, NUSE_SUSPEND);
+    for (i=0; i<BENCH_ITERATIONS; i++)
+    {
+        NUSE_Semaphore_Obtain(BENCH_PING, NUSE_SUSPEND);
+        NUSE_Semaphore_Release(BENCH_PONG);
+    }
+
+    /* queue, pipe and mailbox round trips */
+
+    NUSE_Semaphore_Obtain(BENCH_GO, NUSE_SUSPEND);
+    for (i=0; i<BENCH_ITERATIONS; i++)
+    {
+        NUSE_Queue_Receive(0, &message, NUSE_SUSPEND);
+        NUSE_Queue_Send(1, &message, NUSE_SUSPEND);
+    }
+
+    NUSE_Semaphore_Obtain(BENCH_GO, NUSE_SUSPEND);
+    for (i=0; i<BENCH_ITERATIONS; i++)
+    {
+        NUSE_Pipe_Receive(0, data, sizeof(data), &size, NUSE_SUSPEND);
+        NUSE_Pipe_Send(1, data, sizeof(data), NUSE_SUSPEND);
+    }
+
+    NUSE_Semaphore_Obtain(BENCH_GO, NUSE_SUSPEND);
+    for (i=0; i<BENCH_ITERATIONS; i++)
+    {
+        NUSE_Mailbox_Receive(0, &message, NUSE_SUSPEND);
+        NUSE_Mailbox_Send(1, &message, NUSE_SUSPEND);
+    }
+
+    /* event group set to wake */
+
+    NUSE_Semaphore_Obtain(BENCH_GO, NUSE_SUSPEND);
+    bench_wake_total = 0;
+    for (i=0; i<BENCH_ITERATIONS; i++)
+    {
+        NUSE_Event_Group_Retrieve(0, 1, NUSE_OR_CONSUME, &flags, NUSE_SUSPEND);
+        bench_wake_total += NUSE_CYCLE_COUNTER() - bench_set_time;
+        NUSE_Semaphore_Release(BENCH_PONG);
+    }
+
+    NUSE_Task_Suspend(BENCH_PARTNER);
+}
+
+void bench_main(void)
+{
+    volatile U16 i;                     /* volatile so that the overhead loop is not removed */
+    U32 start;
+    ADDR message, partition;
+    U8 data[4], size;
+
+    bench_append("scheduler,test,statistic,count,cycles\n");
+    NUSE_Latency_Reset();
+
+    /* loop overhead - to be subtracted from the totals below */
+
+    start = NUSE_CYCLE_COUNTER();
+    for (i=0; i<BENCH_ITERATIONS; i++)
+        ;
+    bench_report("loop_overhead", "total", BENCH_ITERATIONS, NUSE_CYCLE_COUNTER() - start);
+
+    /* task switch [relinquish to an equal task] or preemption [resume a higher priority task] */
+
+    #if NUSE_SCHEDULER_TYPE == NUSE_PRIORITY_SCHEDULER
+
+        NUSE_Semaphore_Release(BENCH_GO);           /* partner runs and suspends itself */
+        start = NUSE_CYCLE_COUNTER();
+        for (i=0; i<BENCH_ITERATIONS; i++)
+            NUSE_Task_Resume(BENCH_PARTNER);
+        bench_report("preemption", "total", BENCH_ITERATIONS, NUSE_CYCLE_COUNTER() - start);
+
+    #else
+
+        NUSE_Semaphore_Release(BENCH_GO);
+        start = NUSE_CYCLE_COUNTER();
+        for (i=0; i<BENCH_ITERATIONS; i++)
+            NUSE_Task_Relinquish();
+        bench_report("task_switch", "total", 2 * BENCH_ITERATIONS, NUSE_CYCLE_COUNTER() - start);
+
+    #endif
+
+    /* semaphore shuffle */
+
+    NUSE_Semaphore_Release(BENCH_GO);
+    start = NUSE_CYCLE_COUNTER();
+    for (i=0; i<BENCH_ITERATIONS; i++)
+    {
+        NUSE_Semaphore_Release(BENCH_PING);
+        NUSE_Semaphore_Obtain(BENCH_PONG, NUSE_SUSPEND);
+    }
+    bench_report("semaphore_shuffle", "total", BENCH_ITERATIONS, NUSE_CYCLE_COUNTER() - start);
+
+    /* queue, pipe and mailbox round trips */
+
+    NUSE_Semaphore_Release(BENCH_GO);
+    start = NUSE_CYCLE_COUNTER();
+    for (i=0; i<BENCH_ITERATIONS; i++)
+    {
+        NUSE_Queue_Send(0, &message, NUSE_SUSPEND);
+        NUSE_Queue_Receive(1, &message, NUSE_SUSPEND);
+    }
+    bench_report("queue_round_trip", "total", BENCH_ITERATIONS, NUSE_CYCLE_COUNTER() - start);
+
+    NUSE_Semaphore_Release(BENCH_GO);
+    start = NUSE_CYCLE_COUNTER();
+    for (i=0; i<BENCH_ITERATIONS; i++)
+    {
+        NUSE_Pipe_Send(0, data, sizeof(data), NUSE_SUSPEND);
+        NUSE_Pipe_Receive(1, data, sizeof(data), &size, NUSE_SUSPEND);
+    }
+    bench_report("pipe_round_trip", "total", BENCH_ITERATIONS, NUSE_CYCLE_COUNTER() - start);
+
+    NUSE_Semaphore_Release(BENCH_GO);
+    start = NUSE_CYCLE_COUNTER();
+    for (i=0; i<BENCH_ITERATIONS; i++)
+    {
+        NUSE_Mailbox_Send(0, &message, NUSE_SUSPEND);
+        NUSE_Mailbox_Receive(1, &message, NUSE_SUSPEND);
+    }
+    bench_report("mailbox_round_trip", "total", BENCH_ITERATIONS, NUSE_CYCLE_COUNTER() - start);
+
+    /* partition allocate and free - no partner */
+
+    start = NUSE_CYCLE_COUNTER();
+    for (i=0; i<BENCH_ITERATIONS; i++)
+    {
+        NUSE_Partition_Allocate(0, &partition, NUSE_NO_SUSPEND);
+        NUSE_Partition_Deallocate(partition);
+    }
+    bench_report("partition_alloc_free", "total", BENCH_ITERATIONS, NUSE_CYCLE_COUNTER() - start);
+
+    /* event group set to wake - timed by the partner */
+
+    NUSE_Semaphore_Release(BENCH_GO);
+    for (i=0; i<BENCH_ITERATIONS; i++)
+    {
+        bench_set_time = NUSE_CYCLE_COUNTER();
+        NUSE_Event_Group_Set(0, 1, NUSE_OR);
+        NUSE_Semaphore_Obtain(BENCH_PONG, NUSE_SUSPEND);
+    }
+    bench_report("event_set_to_wake", "total", BENCH_ITERATIONS, bench_wake_total);
+
+    /* context switch latency - block to next task running, over all the tests above */
+
+    bench_latency("switch_latency", NUSE_SWITCH_LATENCY);
+
+    /* interrupt to task latency - clock tick to this task running again */
+
+    NUSE_Task_Resume(BENCH_IDLE);
+    NUSE_Latency_Reset();
+    for (i=0; i<BENCH_TICKS; i++)
+        NUSE_Task_Sleep(1);
+    bench_latency("interrupt_to_task", NUSE_INTERRUPT_LATENCY);
+
+    bench_done = TRUE;
+    NUSE_Task_Suspend(BENCH_MAIN);
+}
+
+void bench_idle(void)
+{
+    while (TRUE)
+    {
+        #if NUSE_SCHEDULER_TYPE != NUSE_PRIORITY_SCHEDULER
+            NUSE_Task_Relinquish();             /* hand straight back to a ready task */
+        #endif
+    }
+}
@@ -0,0 +1,300 @@
+
+#include "nuse_types.h"
+#include "nuse_config.h"
+#include "nuse_config_check.h"
+#include "nuse_codes.h"
+
+/*************************************************************************
+*
+*   This is the file in which the user configures the ROM data for a Nucleus SE application
+*   The items required is largely governed by the settings in nuse_config.h
+*
+*************************************************************************/
+
+
+/*** Task Data ***/
+
+/* Task ROM Data */
+
+void bench_partner(void);       /* task function prototypes */
+void bench_main(void);
+void bench_idle(void);
+
+ROM ADDR NUSE_Task_Start_Address[NUSE_TASK_NUMBER] =
+{
+    /* addresses of task entry functions ------ */
+    bench_partner, bench_main, bench_idle
+};
+
+#if NUSE_SCHEDULER_TYPE != NUSE_RUN_TO_COMPLETION_SCHEDULER
+
+    /* define stack storage - arrays of type ADDR - here */
+
+    ADDR    stack0[200], stack1[200], stack2[200];
+
+    ROM ADDR NUSE_Task_Stack_Base[NUSE_TASK_NUMBER] =
+    {
+        /* addresses of task stacks ------ */
+        stack0, stack1, stack2
+    };
+
+    ROM U16 NUSE_Task_Stack_Size[NUSE_TASK_NUMBER] =
+    {
+        /* stack sizes ------ */
+        200, 200, 200
+    };
+
+
+#endif
+
+#if NUSE_INITIAL_TASK_STATE_SUPPORT
+
+    ROM U8 NUSE_Task_Initial_State[NUSE_TASK_NUMBER] =
+    {
+        /* task states ------ */
+        /* may be NUSE_READY or NUSE_PURE_SUSPEND */
+        NUSE_READY, NUSE_READY, NUSE_PURE_SUSPEND
+    };
+
+#endif
+
+/*** Partition Pool data ***/
+
+#if NUSE_PARTITION_POOL_NUMBER > 0
+
+    /* need to declare/define the partition pool RAM space here - array of type U8 */
+    /* size in bytes must be (number or partitions * (partition size + 1)) */
+    /* or, if NUSE_PARTITION_ALIGNMENT is not 0, (number of partitions * partition size rounded up to the alignment) */
+    /* and the pool must start on an aligned address */
+    /* and the free list - array of type NUSE_PARTITION_COUNT, one entry per partition */
+    /* and, if NUSE_Partition_Reference() or NUSE_Partition_Send() is used, the reference counts - array of type U8, one entry per partition */
+    /* number of partitions in each pool must be 1-254, or 1-65534 if NUSE_PARTITION_COUNT_WIDTH is 16 */
+
+    U8 BenchPartitionPool[4 * (16 + 1)];
+    NUSE_PARTITION_COUNT BenchPartitionList[4];
+
+    #if NUSE_PARTITION_REFERENCE || NUSE_PARTITION_SEND || NUSE_INCLUDE_EVERYTHING
+        U8 BenchPartitionReferences[4];
+    #endif
+
+    /* Partition Pool ROM Data */
+
+    ROM ADDR NUSE_Partition_Pool_Data_Address[NUSE_PARTITION_POOL_NUMBER] =
+    {
+        /* address of partition pools ------ */
+        BenchPartitionPool
+    };
+
+    ROM NUSE_PARTITION_COUNT NUSE_Partition_Pool_Partition_Number[NUSE_PARTITION_POOL_NUMBER] =
+    {
+        /* number of partitions in each pool ------ */
+        4
+    };
+
+    ROM U16 NUSE_Partition_Pool_Partition_Size[NUSE_PARTITION_POOL_NUMBER] =
+    {
+        /* partition sizes ------ */
+        /* in bytes */
+        16
+    };
+
+    ROM NUSE_PARTITION_COUNT *NUSE_Partition_Pool_Free_List[NUSE_PARTITION_POOL_NUMBER] =
+    {
+        /* addresses of partition pool free lists ------ */
+        BenchPartitionList
+    };
+
+    #if NUSE_PARTITION_REFERENCE || NUSE_PARTITION_SEND || NUSE_INCLUDE_EVERYTHING
+
+        ROM U8 *NUSE_Partition_Pool_References[NUSE_PARTITION_POOL_NUMBER] =
+        {
+            /* addresses of partition pool reference counts ------ */
+            BenchPartitionReferences
+        };
+
+    #endif
+
+#endif
+
+/*** Memory Pool data ***/
+
+#if NUSE_MEMORY_POOL_NUMBER > 0
+
+    /* need to declare/define the memory pool RAM space here - array of type U32 */
+    /* so that the pool is aligned; size in bytes must be 8-65532 */
+
+    /* Memory Pool ROM Data */
+
+    ROM ADDR NUSE_Memory_Pool_Data_Address[NUSE_MEMORY_POOL_NUMBER] =
+    {
+        /* address of memory pools ------ */
+    };
+
+    ROM U16 NUSE_Memory_Pool_Size[NUSE_MEMORY_POOL_NUMBER] =
+    {
+        /* memory pool sizes ------ */
+        /* in bytes */
+    };
+
+#endif
+
+/*** Queue Data ***/
+
+#if NUSE_QUEUE_NUMBER > 0
+
+    /* need to declare/define the queue RAM space here - array of type ADDR */
+    /* size in bytes must be (queue size * sizeof(ADDR)) */
+    /* i.e. array size is just the queue size */
+
+    ADDR BenchQueue0[1], BenchQueue1[1];
+
+    /* Queue ROM Data */
+
+    ROM ADDR *NUSE_Queue_Data[NUSE_QUEUE_NUMBER] =
+    {
+        /* addresses of queue data areas ------ */
+        BenchQueue0, BenchQueue1
+    };
+
+    ROM U8 NUSE_Queue_Size[NUSE_QUEUE_NUMBER] =
+    {
+        /* queue sizes ------ */
+        1, 1
+    };
+
+#endif
+
+/*** Pipe Data ***/
+
+#if NUSE_PIPE_NUMBER > 0
+
+    /* need to declare/define the pipe RAM space here - array of type U8 */
+    /* size in bytes must be (pipe size * pipe message size) */
+
+    U8 BenchPipe0[4], BenchPipe1[4];
+
+    /* Pipe ROM Data */
+
+    ROM U8 *NUSE_Pipe_Data[NUSE_PIPE_NUMBER] =
+    {
+        /* addresses of pipe data areas ------ */
+        BenchPipe0, BenchPipe1
+    };
+
+    ROM U8 NUSE_Pipe_Size[NUSE_PIPE_NUMBER] =
+    {
+        /* pipe sizes ------ */
+        1, 1
+    };
+
+    ROM U8 NUSE_Pipe_Message_Size[NUSE_PIPE_NUMBER] =
+    {
+        /* pipe message sizes ------ */
+        4, 4
+    };
+
+#endif
+
+/*** Channel Data ***/
+
+#if NUSE_CHANNEL_NUMBER > 0
+
+    /* need to declare/define the channel RAM space here - array of type ADDR */
+    /* array size is the channel size [at least 2]; a channel holds up to (channel size - 1) messages */
+
+    /* Channel ROM Data */
+
+    ROM ADDR *NUSE_Channel_Data[NUSE_CHANNEL_NUMBER] =
+    {
+        /* addresses of channel data areas ------ */
+    };
+
+    ROM U8 NUSE_Channel_Size[NUSE_CHANNEL_NUMBER] =
+    {
+        /* channel sizes ------ */
+    };
+
+#endif
+
+/*** State Board Data ***/
+
+#if NUSE_BOARD_NUMBER > 0
+
+    /* need to declare/define the state board RAM space here - array of type U8 */
+    /* array size is twice the record size, as the board holds two copies of the record */
+
+    /* State Board ROM Data */
+
+    ROM U8 *NUSE_Board_Data[NUSE_BOARD_NUMBER] =
+    {
+        /* addresses of state board data areas ------ */
+    };
+
+    ROM U8 NUSE_Board_Size[NUSE_BOARD_NUMBER] =
+    {
+        /* state board record sizes ------ */
+    };
+
+#endif
+
+/*** Semaphore Data ***/
+
+#if NUSE_SEMAPHORE_NUMBER > 0
+
+    /* Semaphore ROM Data */
+
+    ROM NUSE_SEMAPHORE_COUNTER NUSE_Semaphore_Initial_Value[NUSE_SEMAPHORE_NUMBER] =
+    {
+        /* semaphore initial count values */
+        0, 0, 0
+    };
+
+#endif
+
+/*** Binary Semaphore Data ***/
+
+#if NUSE_BINARY_SEMAPHORE_NUMBER > 0
+
+    /* Binary Semaphore ROM Data */
+
+    ROM U8 NUSE_Binary_Semaphore_Initial_Value[NUSE_BINARY_SEMAPHORE_NUMBER] =
+    {
+        /* binary semaphore initial states - TRUE if available */
+    };
+
+#endif
+
+/*** Timer Data ***/
+
+#if NUSE_TIMER_NUMBER > 0
+
+    /* Timer ROM Data */
+
+    ROM U16 NUSE_Timer_Initial_Time[NUSE_TIMER_NUMBER] =
+    {
+        /* timer initial times ------ */
+    };
+
+    ROM U16 NUSE_Timer_Reschedule_Time[NUSE_TIMER_NUMBER] =
+    {
+        /* timer reschedule times ------ */
+    };
+
+    #if NUSE_TIMER_EXPIRATION_ROUTINE_SUPPORT
+
+        /* need prototypes of expiration routines here */
+
+        ROM ADDR NUSE_Timer_Expiration_Routine_Address[NUSE_TIMER_NUMBER] =
+        {
+            /* addresses of timer expiration routines ------ */
+            /* can be NULL */
+        };
+
+        ROM U8 NUSE_Timer_Expiration_Routine_Parameter[NUSE_TIMER_NUMBER] =
+        {
+            /* timer expiration routine parameters ------ */
+        };
+
+    #endif
+
+#endif
\ No newline at end of file
@@ -0,0 +1,194 @@
+#include "nuse.h"
+#include "nuse_data.h"
+
+/*************************************************************************
+*
+*   Kernel scaling benchmark
+*   Measures the costs which grow with the number of tasks, timers and
+*   partitions configured - built once for each combination of
+*   BENCH_TASKS, BENCH_TIMERS and BENCH_PARTITIONS [see nuse_config.h]
+*   All tasks run bench_task(), which picks a role by task index:
+*       task 0 [highest priority]       partner - preempts the main task
+*       tasks 1 to n-2                  sleepers - keep the tick ISR's sleep loop busy
+*       task n-1 [lowest priority]      main - times the tests
+*   Results are written as CSV text to bench_results[]; bench_done is set
+*   by bench_stop() when the run is complete, so a debugger may stop there
+*   to read the results [see sweep.sh]
+*
+*************************************************************************/
+
+#define BENCH_ITERATIONS    1000        /* operations timed by the reschedule and wake tests */
+#define BENCH_TICKS         100         /* clock ticks timed by the tick test */
+
+#define BENCH_PARTNER       0           /* task indices */
+#define BENCH_MAIN          (NUSE_TASK_NUMBER - 1)
+
+#define BENCH_TICK_CLOCK    (*(volatile U32 *)&NUSE_Tick_Clock)
+
+char bench_results[512];                /* CSV results - read out by debugger or copied to a UART */
+U16 bench_length;
+volatile U8 bench_done;
+
+volatile U32 bench_release_time;        /* wake test - time at which the semaphore was released */
+U32 bench_wake_total;                   /* wake test - accumulated by the partner */
+
+ADDR bench_partitions[BENCH_PARTITIONS];
+
+
+void bench_append(char *text)
+{
+    while ((*text != '\0') && (bench_length < sizeof(bench_results) - 1))
+        bench_results[bench_length++] = *text++;
+
+    bench_results[bench_length] = '\0';
+}
+
+void bench_number(U32 value)
+{
+    char digits[11];
+    U8 i;
+
+    i = sizeof(digits) - 1;
+    digits[i] = '\0';
+    do
+    {
+        digits[--i] = '0' + (char)(value % 10);
+        value /= 10;
+    } while (value != 0);
+
+    bench_append(&digits[i]);
+}
+
+void bench_report(char *test, U32 count, U32 cycles)
+{
+    bench_number(BENCH_TASKS);
+    bench_append(",");
+    bench_number(BENCH_TIMERS);
+    bench_append(",");
+    bench_number(BENCH_PARTITIONS);
+    bench_append(",");
+    bench_append(test);
+    bench_append(",");
+    bench_number(count);
+    bench_append(",");
+    bench_number(cycles);
+    bench_append("\n");
+}
+
+void bench_stop(void)
+{
+    bench_done = TRUE;
+}
+
+
+void bench_partner(void)
+{
+    U16 i;
+
+    /* reschedule - suspend back to the main task, past all the sleepers */
+
+    for (i=0; i<BENCH_ITERATIONS; i++)
+        NUSE_Task_Suspend(BENCH_PARTNER);
+
+    /* wake - semaphore release to this task running */
+
+    bench_wake_total = 0;
+    for (i=0; i<BENCH_ITERATIONS; i++)
+    {
+        NUSE_Semaphore_Obtain(0, NUSE_SUSPEND);
+        bench_wake_total += NUSE_CYCLE_COUNTER() - bench_release_time;
+    }
+
+    NUSE_Task_Suspend(BENCH_PARTNER);
+}
+
+void bench_sleeper(void)
+{
+    while (TRUE)
+        NUSE_Task_Sleep(60000);
+}
+
+void bench_main(void)
+{
+    #if (BENCH_TASKS > 1) || (BENCH_TIMERS != 0)
+        U16 i;
+    #endif
+    U32 start, begin, now, last, fastest, passes;
+    NUSE_PARTITION_COUNT p;
+
+    #if BENCH_TIMERS != 0
+        for (i=0; i<BENCH_TIMERS; i++)
+            NUSE_Timer_Control(i, NUSE_ENABLE_TIMER);
+    #endif
+
+    #if BENCH_TASKS > 1
+
+        /* reschedule - resume the partner, which suspends itself again */
+
+        start = NUSE_CYCLE_COUNTER();
+        for (i=0; i<BENCH_ITERATIONS; i++)
+            NUSE_Task_Resume(BENCH_PARTNER);
+        bench_report("reschedule", BENCH_ITERATIONS, NUSE_CYCLE_COUNTER() - start);
+
+        /* wake - release a semaphore on which the partner is blocked */
+
+        for (i=0; i<BENCH_ITERATIONS; i++)
+        {
+            bench_release_time = NUSE_CYCLE_COUNTER();
+            NUSE_Semaphore_Release(0);
+        }
+        bench_report("wake", BENCH_ITERATIONS, bench_wake_total);
+
+    #endif
+
+    /* tick - time taken from this loop by the clock ISR */
+    /* the fastest pass of the loop is taken as undisturbed; anything more was stolen */
+
+    start = BENCH_TICK_CLOCK;
+    while (BENCH_TICK_CLOCK == start)        /* start on a tick boundary */
+        ;
+    start = BENCH_TICK_CLOCK;
+
+    fastest = 0xffffffff;
+    passes = 0;
+    begin = last = NUSE_CYCLE_COUNTER();
+    while (BENCH_TICK_CLOCK - start < BENCH_TICKS)
+    {
+        now = NUSE_CYCLE_COUNTER();
+        if (now - last < fastest)
+            fastest = now - last;
+        last = now;
+        passes++;
+    }
+    bench_report("tick", BENCH_TICKS, (last - begin) - (passes * fastest));
+
+    /* allocate and deallocate - empty the pool, then fill it again */
+
+    start = NUSE_CYCLE_COUNTER();
+    for (p=0; p<BENCH_PARTITIONS; p++)
+        NUSE_Partition_Allocate(0, &bench_partitions[p], NUSE_NO_SUSPEND);
+    bench_report("allocate", BENCH_PARTITIONS, NUSE_CYCLE_COUNTER() - start);
+
+    start = NUSE_CYCLE_COUNTER();
+    for (p=0; p<BENCH_PARTITIONS; p++)
+        NUSE_Partition_Deallocate(bench_partitions[p]);
+    bench_report("deallocate", BENCH_PARTITIONS, NUSE_CYCLE_COUNTER() - start);
+
+    bench_stop();
+    while (TRUE)                            /* nothing else is ready to run */
+        ;
+}
+
+void bench_task(void)
+{
+    NUSE_TASK task;
+
+    task = NUSE_Task_Current();
+
+    if (task == BENCH_MAIN)
+        bench_main();
+    else if (task == BENCH_PARTNER)
+        bench_partner();
+    else
+        bench_sleeper();
+}
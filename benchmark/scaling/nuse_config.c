@@ -0,0 +1,321 @@
+
+#include "nuse_types.h"
+#include "nuse_config.h"
+#include "nuse_config_check.h"
+#include "nuse_codes.h"
+
+/*************************************************************************
+*
+*   This is the file in which the user configures the ROM data for a Nucleus SE application
+*   The items required is largely governed by the settings in nuse_config.h
+*
+*************************************************************************/
+
+
+/*** Configuration lists ***/
+
+/* BENCH_LIST(n, ITEM) expands to ITEM(0), ITEM(1) ... ITEM(n-1) */
+/* n must be a literal number, such as BENCH_TASKS */
+
+#define BENCH_LIST(n, ITEM)     BENCH_LIST_EXPAND(n, ITEM)
+#define BENCH_LIST_EXPAND(n, ITEM)  BENCH_LIST_##n(ITEM)
+
+#define BENCH_LIST_1(ITEM)      ITEM(0)
+#define BENCH_LIST_2(ITEM)      BENCH_LIST_1(ITEM), ITEM(1)
+#define BENCH_LIST_3(ITEM)      BENCH_LIST_2(ITEM), ITEM(2)
+#define BENCH_LIST_4(ITEM)      BENCH_LIST_3(ITEM), ITEM(3)
+#define BENCH_LIST_5(ITEM)      BENCH_LIST_4(ITEM), ITEM(4)
+#define BENCH_LIST_6(ITEM)      BENCH_LIST_5(ITEM), ITEM(5)
+#define BENCH_LIST_7(ITEM)      BENCH_LIST_6(ITEM), ITEM(6)
+#define BENCH_LIST_8(ITEM)      BENCH_LIST_7(ITEM), ITEM(7)
+#define BENCH_LIST_9(ITEM)      BENCH_LIST_8(ITEM), ITEM(8)
+#define BENCH_LIST_10(ITEM)     BENCH_LIST_9(ITEM), ITEM(9)
+#define BENCH_LIST_11(ITEM)     BENCH_LIST_10(ITEM), ITEM(10)
+#define BENCH_LIST_12(ITEM)     BENCH_LIST_11(ITEM), ITEM(11)
+#define BENCH_LIST_13(ITEM)     BENCH_LIST_12(ITEM), ITEM(12)
+#define BENCH_LIST_14(ITEM)     BENCH_LIST_13(ITEM), ITEM(13)
+#define BENCH_LIST_15(ITEM)     BENCH_LIST_14(ITEM), ITEM(14)
+#define BENCH_LIST_16(ITEM)     BENCH_LIST_15(ITEM), ITEM(15)
+
+#define BENCH_TASK_ENTRY(i)     bench_task
+#define BENCH_TASK_STACK(i)     bench_stack[i]
+#define BENCH_TASK_STACK_SIZE(i) 200
+#define BENCH_TIMER_TIME(i)     60000           /* long enough not to expire during a run */
+
+
+/*** Task Data ***/
+
+/* Task ROM Data */
+
+void bench_task(void);          /* task function prototype - shared by all tasks */
+
+ROM ADDR NUSE_Task_Start_Address[NUSE_TASK_NUMBER] =
+{
+    /* addresses of task entry functions ------ */
+    BENCH_LIST(BENCH_TASKS, BENCH_TASK_ENTRY)
+};
+
+#if NUSE_SCHEDULER_TYPE != NUSE_RUN_TO_COMPLETION_SCHEDULER
+
+    /* define stack storage - arrays of type ADDR - here */
+
+    ADDR    bench_stack[NUSE_TASK_NUMBER][200];
+
+    ROM ADDR NUSE_Task_Stack_Base[NUSE_TASK_NUMBER] =
+    {
+        /* addresses of task stacks ------ */
+        BENCH_LIST(BENCH_TASKS, BENCH_TASK_STACK)
+    };
+
+    ROM U16 NUSE_Task_Stack_Size[NUSE_TASK_NUMBER] =
+    {
+        /* stack sizes ------ */
+        BENCH_LIST(BENCH_TASKS, BENCH_TASK_STACK_SIZE)
+    };
+
+
+#endif
+
+#if NUSE_INITIAL_TASK_STATE_SUPPORT
+
+    ROM U8 NUSE_Task_Initial_State[NUSE_TASK_NUMBER] =
+    {
+        /* task states ------ */
+        /* may be NUSE_READY or NUSE_PURE_SUSPEND */
+    };
+
+#endif
+
+/*** Partition Pool data ***/
+
+#if NUSE_PARTITION_POOL_NUMBER > 0
+
+    /* need to declare/define the partition pool RAM space here - array of type U8 */
+    /* size in bytes must be (number or partitions * (partition size + 1)) */
+    /* or, if NUSE_PARTITION_ALIGNMENT is not 0, (number of partitions * partition size rounded up to the alignment) */
+    /* and the pool must start on an aligned address */
+    /* and the free list - array of type NUSE_PARTITION_COUNT, one entry per partition */
+    /* and, if NUSE_Partition_Reference() or NUSE_Partition_Send() is used, the reference counts - array of type U8, one entry per partition */
+    /* number of partitions in each pool must be 1-254, or 1-65534 if NUSE_PARTITION_COUNT_WIDTH is 16 */
+
+    U8 BenchPartitionPool[BENCH_PARTITIONS * (16 + 1)];
+    NUSE_PARTITION_COUNT BenchPartitionList[BENCH_PARTITIONS];
+
+    #if NUSE_PARTITION_REFERENCE || NUSE_PARTITION_SEND || NUSE_INCLUDE_EVERYTHING
+        U8 BenchPartitionReferences[BENCH_PARTITIONS];
+    #endif
+
+    /* Partition Pool ROM Data */
+
+    ROM ADDR NUSE_Partition_Pool_Data_Address[NUSE_PARTITION_POOL_NUMBER] =
+    {
+        /* address of partition pools ------ */
+        BenchPartitionPool
+    };
+
+    ROM NUSE_PARTITION_COUNT NUSE_Partition_Pool_Partition_Number[NUSE_PARTITION_POOL_NUMBER] =
+    {
+        /* number of partitions in each pool ------ */
+        BENCH_PARTITIONS
+    };
+
+    ROM U16 NUSE_Partition_Pool_Partition_Size[NUSE_PARTITION_POOL_NUMBER] =
+    {
+        /* partition sizes ------ */
+        /* in bytes */
+        16
+    };
+
+    ROM NUSE_PARTITION_COUNT *NUSE_Partition_Pool_Free_List[NUSE_PARTITION_POOL_NUMBER] =
+    {
+        /* addresses of partition pool free lists ------ */
+        BenchPartitionList
+    };
+
+    #if NUSE_PARTITION_REFERENCE || NUSE_PARTITION_SEND || NUSE_INCLUDE_EVERYTHING
+
+        ROM U8 *NUSE_Partition_Pool_References[NUSE_PARTITION_POOL_NUMBER] =
+        {
+            /* addresses of partition pool reference counts ------ */
+            BenchPartitionReferences
+        };
+
+    #endif
+
+#endif
+
+/*** Memory Pool data ***/
+
+#if NUSE_MEMORY_POOL_NUMBER > 0
+
+    /* need to declare/define the memory pool RAM space here - array of type U32 */
+    /* so that the pool is aligned; size in bytes must be 8-65532 */
+
+    /* Memory Pool ROM Data */
+
+    ROM ADDR NUSE_Memory_Pool_Data_Address[NUSE_MEMORY_POOL_NUMBER] =
+    {
+        /* address of memory pools ------ */
+    };
+
+    ROM U16 NUSE_Memory_Pool_Size[NUSE_MEMORY_POOL_NUMBER] =
+    {
+        /* memory pool sizes ------ */
+        /* in bytes */
+    };
+
+#endif
+
+/*** Queue Data ***/
+
+#if NUSE_QUEUE_NUMBER > 0
+
+    /* need to declare/define the queue RAM space here - array of type ADDR */
+    /* size in bytes must be (queue size * sizeof(ADDR)) */
+    /* i.e. array size is just the queue size */
+
+    /* Queue ROM Data */
+
+    ROM ADDR *NUSE_Queue_Data[NUSE_QUEUE_NUMBER] =
+    {
+        /* addresses of queue data areas ------ */
+    };
+
+    ROM U8 NUSE_Queue_Size[NUSE_QUEUE_NUMBER] =
+    {
+        /* queue sizes ------ */
+    };
+
+#endif
+
+/*** Pipe Data ***/
+
+#if NUSE_PIPE_NUMBER > 0
+
+    /* need to declare/define the pipe RAM space here - array of type U8 */
+    /* size in bytes must be (pipe size * pipe message size) */
+
+    /* Pipe ROM Data */
+
+    ROM U8 *NUSE_Pipe_Data[NUSE_PIPE_NUMBER] =
+    {
+        /* addresses of pipe data areas ------ */
+    };
+
+    ROM U8 NUSE_Pipe_Size[NUSE_PIPE_NUMBER] =
+    {
+        /* pipe sizes ------ */
+    };
+
+    ROM U8 NUSE_Pipe_Message_Size[NUSE_PIPE_NUMBER] =
+    {
+        /* pipe message sizes ------ */
+    };
+
+#endif
+
+/*** Channel Data ***/
+
+#if NUSE_CHANNEL_NUMBER > 0
+
+    /* need to declare/define the channel RAM space here - array of type ADDR */
+    /* array size is the channel size [at least 2]; a channel holds up to (channel size - 1) messages */
+
+    /* Channel ROM Data */
+
+    ROM ADDR *NUSE_Channel_Data[NUSE_CHANNEL_NUMBER] =
+    {
+        /* addresses of channel data areas ------ */
+    };
+
+    ROM U8 NUSE_Channel_Size[NUSE_CHANNEL_NUMBER] =
+    {
+        /* channel sizes ------ */
+    };
+
+#endif
+
+/*** State Board Data ***/
+
+#if NUSE_BOARD_NUMBER > 0
+
+    /* need to declare/define the state board RAM space here - array of type U8 */
+    /* array size is twice the record size, as the board holds two copies of the record */
+
+    /* State Board ROM Data */
+
+    ROM U8 *NUSE_Board_Data[NUSE_BOARD_NUMBER] =
+    {
+        /* addresses of state board data areas ------ */
+    };
+
+    ROM U8 NUSE_Board_Size[NUSE_BOARD_NUMBER] =
+    {
+        /* state board record sizes ------ */
+    };
+
+#endif
+
+/*** Semaphore Data ***/
+
+#if NUSE_SEMAPHORE_NUMBER > 0
+
+    /* Semaphore ROM Data */
+
+    ROM NUSE_SEMAPHORE_COUNTER NUSE_Semaphore_Initial_Value[NUSE_SEMAPHORE_NUMBER] =
+    {
+        /* semaphore initial count values */
+        0
+    };
+
+#endif
+
+/*** Binary Semaphore Data ***/
+
+#if NUSE_BINARY_SEMAPHORE_NUMBER > 0
+
+    /* Binary Semaphore ROM Data */
+
+    ROM U8 NUSE_Binary_Semaphore_Initial_Value[NUSE_BINARY_SEMAPHORE_NUMBER] =
+    {
+        /* binary semaphore initial states - TRUE if available */
+    };
+
+#endif
+
+/*** Timer Data ***/
+
+#if NUSE_TIMER_NUMBER > 0
+
+    /* Timer ROM Data */
+
+    ROM U16 NUSE_Timer_Initial_Time[NUSE_TIMER_NUMBER] =
+    {
+        /* timer initial times ------ */
+        BENCH_LIST(BENCH_TIMERS, BENCH_TIMER_TIME)
+    };
+
+    ROM U16 NUSE_Timer_Reschedule_Time[NUSE_TIMER_NUMBER] =
+    {
+        /* timer reschedule times ------ */
+        BENCH_LIST(BENCH_TIMERS, BENCH_TIMER_TIME)
+    };
+
+    #if NUSE_TIMER_EXPIRATION_ROUTINE_SUPPORT
+
+        /* need prototypes of expiration routines here */
+
+        ROM ADDR NUSE_Timer_Expiration_Routine_Address[NUSE_TIMER_NUMBER] =
+        {
+            /* addresses of timer expiration routines ------ */
+            /* can be NULL */
+        };
+
+        ROM U8 NUSE_Timer_Expiration_Routine_Parameter[NUSE_TIMER_NUMBER] =
+        {
+            /* timer expiration routine parameters ------ */
+        };
+
+    #endif
+
+#endif
\ No newline at end of file
@@ -0,0 +1,255 @@
+/*************************************************************************
+*
+*   This is the primary configuration file for a Nucleus SE application
+*   Here you can select:
+*       How many of each object type are configured
+*       Which API calls are available
+*       Which scheduler type is used
+*       A selection of other optional kernel facilities
+*
+*************************************************************************/
+
+
+/* Check to see if the file has been included already.  */
+#ifndef _NUSE_CONFIG_H_
+#define _NUSE_CONFIG_H_
+
+/*** Benchmark parameters - may be set on the compiler command line ***/
+
+#ifndef BENCH_TASKS
+    #define BENCH_TASKS         16      /* Number of tasks - 1-16 */
+#endif
+
+#ifndef BENCH_TIMERS
+    #define BENCH_TIMERS        16      /* Number of running timers - 0-16 */
+#endif
+
+#ifndef BENCH_PARTITIONS
+    #define BENCH_PARTITIONS    254     /* Number of partitions in the pool - 1-65534 */
+#endif
+
+
+/*** API calls ***/
+
+#define NUSE_API_PARAMETER_CHECKING     TRUE    /* option enabler */
+
+/*** Tasks and task control ***/
+
+#define NUSE_TASK_NUMBER        BENCH_TASKS     /* Number of tasks in the system - 1-16 */
+
+#define NUSE_TASK_SUSPEND       TRUE            /* Service call enabler */
+#define NUSE_TASK_RESUME        TRUE            /* Service call enabler */
+#define NUSE_TASK_SLEEP         TRUE            /* Service call enabler */
+#define NUSE_TASK_RELINQUISH    FALSE           /* Service call enabler */
+#define NUSE_TASK_CURRENT       TRUE            /* Service call enabler */
+#define NUSE_TASK_CHECK_STACK   FALSE           /* Service call enabler */
+#define NUSE_TASK_RESET         FALSE           /* Service call enabler */
+#define NUSE_TASK_INFORMATION   FALSE           /* Service call enabler */
+#define NUSE_TASK_COUNT         FALSE           /* Service call enabler */
+#define NUSE_TASK_WAIT_MULTIPLE FALSE           /* Service call enabler */
+#define NUSE_TASK_STACK_HIGH_WATER FALSE        /* Service call enabler */
+#define NUSE_TASK_RUNTIME       FALSE           /* Service call enabler */
+#define NUSE_TASK_LOAD          FALSE           /* Service call enabler */
+#define NUSE_TASK_RUNTIME_RESET FALSE           /* Service call enabler */
+
+#define NUSE_INITIAL_TASK_STATE_SUPPORT FALSE   /* Enables support for tasks starting as suspended */
+
+/*** Partition pools ***/
+
+#define NUSE_PARTITION_POOL_NUMBER      1       /* Number of partition pools in the system - 0-16 */
+#define NUSE_PARTITION_ALIGNMENT        0       /* Partition alignment in bytes - 0 [status byte before each partition] or a power of 2 */
+#define NUSE_PARTITION_COUNT_WIDTH      16      /* Partition count size in bits - 8 [up to 254 partitions per pool] or 16 */
+
+#define NUSE_PARTITION_ALLOCATE         TRUE    /* Service call enabler */
+#define NUSE_PARTITION_ALLOCATE_SIZE    FALSE   /* Service call enabler */
+#define NUSE_PARTITION_DEALLOCATE       TRUE    /* Service call enabler */
+#define NUSE_PARTITION_REFERENCE        FALSE   /* Service call enabler */
+#define NUSE_PARTITION_SEND             FALSE   /* Service call enabler */
+#define NUSE_PARTITION_POOL_INFORMATION FALSE   /* Service call enabler */
+#define NUSE_PARTITION_POOL_STATISTICS  FALSE   /* Service call enabler */
+#define NUSE_PARTITION_POOL_COUNT       FALSE   /* Service call enabler */
+
+/*** Memory pools ***/
+
+#define NUSE_MEMORY_POOL_NUMBER         0       /* Number of memory pools in the system - 0-16 */
+
+#define NUSE_MEMORY_ALLOCATE            FALSE   /* Service call enabler */
+#define NUSE_MEMORY_DEALLOCATE          FALSE   /* Service call enabler */
+#define NUSE_MEMORY_POOL_INFORMATION    FALSE   /* Service call enabler */
+#define NUSE_MEMORY_POOL_COUNT          FALSE   /* Service call enabler */
+
+/*** Mailboxes ***/
+
+#define NUSE_MAILBOX_NUMBER         0           /* Number of mailboxes in the system - 0-16 */
+
+#define NUSE_MAILBOX_SEND           FALSE       /* Service call enabler */
+#define NUSE_MAILBOX_RECEIVE        FALSE       /* Service call enabler */
+#define NUSE_MAILBOX_OVERWRITE      FALSE       /* Service call enabler */
+#define NUSE_MAILBOX_RESET          FALSE       /* Service call enabler */
+#define NUSE_MAILBOX_INFORMATION    FALSE       /* Service call enabler */
+#define NUSE_MAILBOX_COUNT          FALSE       /* Service call enabler */
+
+/*** Queues ***/
+
+#define NUSE_QUEUE_NUMBER       0               /* Number of queues in the system - 0-16 */
+
+#define NUSE_QUEUE_SEND         FALSE           /* Service call enabler */
+#define NUSE_QUEUE_RECEIVE      FALSE           /* Service call enabler */
+#define NUSE_QUEUE_JAM          FALSE           /* Service call enabler */
+#define NUSE_QUEUE_BROADCAST    FALSE           /* Service call enabler */
+#define NUSE_QUEUE_RESET        FALSE           /* Service call enabler */
+#define NUSE_QUEUE_INFORMATION  FALSE           /* Service call enabler */
+#define NUSE_QUEUE_COUNT        FALSE           /* Service call enabler */
+
+/*** Pipes ***/
+
+#define NUSE_PIPE_NUMBER        0               /* Number of pipes in the system - 0-16 */
+
+#define NUSE_PIPE_SEND          FALSE           /* Service call enabler */
+#define NUSE_PIPE_RECEIVE       FALSE           /* Service call enabler */
+#define NUSE_PIPE_JAM           FALSE           /* Service call enabler */
+#define NUSE_PIPE_BROADCAST     FALSE           /* Service call enabler */
+#define NUSE_PIPE_RESET         FALSE           /* Service call enabler */
+#define NUSE_PIPE_INFORMATION   FALSE           /* Service call enabler */
+#define NUSE_PIPE_COUNT         FALSE           /* Service call enabler */
+
+/*** Channels ***/
+
+#define NUSE_CHANNEL_NUMBER     0               /* Number of channels in the system - 0-16 */
+
+#define NUSE_CHANNEL_PUT        FALSE           /* Service call enabler */
+#define NUSE_CHANNEL_GET        FALSE           /* Service call enabler */
+#define NUSE_CHANNEL_INFORMATION FALSE          /* Service call enabler */
+#define NUSE_CHANNEL_COUNT      FALSE           /* Service call enabler */
+
+/*** State Boards ***/
+
+#define NUSE_BOARD_NUMBER       0               /* Number of state boards in the system - 0-16 */
+
+#define NUSE_BOARD_WRITE        FALSE           /* Service call enabler */
+#define NUSE_BOARD_READ         FALSE           /* Service call enabler */
+#define NUSE_BOARD_INFORMATION  FALSE           /* Service call enabler */
+#define NUSE_BOARD_COUNT        FALSE           /* Service call enabler */
+
+/*** Semaphores ***/
+
+#define NUSE_SEMAPHORE_NUMBER       1           /* Number of semaphores in the system - 0-16 */
+#define NUSE_SEMAPHORE_WIDTH        8           /* Semaphore counter size in bits - 8, 16 or 32 */
+
+#define NUSE_SEMAPHORE_OBTAIN       TRUE        /* Service call enabler */
+#define NUSE_SEMAPHORE_RELEASE      TRUE        /* Service call enabler */
+#define NUSE_SEMAPHORE_RESET        FALSE       /* Service call enabler */
+#define NUSE_SEMAPHORE_INFORMATION  FALSE       /* Service call enabler */
+#define NUSE_SEMAPHORE_COUNT        FALSE       /* Service call enabler */
+
+#define NUSE_BINARY_SEMAPHORE_NUMBER    0       /* Number of binary semaphores in the system - 0-16 */
+
+#define NUSE_BINARY_SEMAPHORE_OBTAIN    FALSE   /* Service call enabler */
+#define NUSE_BINARY_SEMAPHORE_RELEASE   FALSE   /* Service call enabler */
+#define NUSE_BINARY_SEMAPHORE_COUNT     FALSE   /* Service call enabler */
+
+/*** Event groups ***/
+
+#define NUSE_EVENT_GROUP_NUMBER         0       /* Number of event groups in the system - 0-16 */
+#define NUSE_EVENT_GROUP_WIDTH          8       /* Number of flags in each event group - 8, 16 or 32 */
+
+#define NUSE_EVENT_GROUP_SET            FALSE   /* Service call enabler */
+#define NUSE_EVENT_GROUP_RETRIEVE       FALSE   /* Service call enabler */
+#define NUSE_EVENT_GROUP_INFORMATION    FALSE   /* Service call enabler */
+#define NUSE_EVENT_GROUP_COUNT          FALSE   /* Service call enabler */
+
+/*** Signals ***/
+
+#define NUSE_SIGNAL_SUPPORT     FALSE           /* Enables support for signals */
+
+#define NUSE_SIGNALS_SEND       FALSE           /* Service call enabler */
+#define NUSE_SIGNALS_RECEIVE    FALSE           /* Service call enabler */
+#define NUSE_SIGNALS_WAIT       FALSE           /* Service call enabler */
+
+/*** Timers ***/
+
+#define NUSE_TIMER_NUMBER           BENCH_TIMERS    /* Number of application timers in the system - 0-16 */
+
+#define NUSE_TIMER_CONTROL          (BENCH_TIMERS != 0)    /* Service call enabler */
+#define NUSE_TIMER_GET_REMAINING    FALSE       /* Service call enabler */
+#define NUSE_TIMER_RESET            FALSE       /* Service call enabler */
+#define NUSE_TIMER_INFORMATION      FALSE       /* Service call enabler */
+#define NUSE_TIMER_COUNT            FALSE       /* Service call enabler */
+
+#define NUSE_TIMER_EXPIRATION_ROUTINE_SUPPORT FALSE /* Enables execution of timer expiration function */
+
+/*** System time ***/
+
+#define NUSE_SYSTEM_TIME_SUPPORT    TRUE        /* Enables the system tick clock */
+
+#define NUSE_CLOCK_SET              FALSE       /* Service call enabler */
+#define NUSE_CLOCK_RETRIEVE         FALSE       /* Service call enabler */
+
+/*** System Diagnostics ***/
+
+#define NUSE_RELEASE_INFORMATION    FALSE       /* Service call enabler */
+
+/*** Scheduler and task suspend ***/
+
+#define NUSE_RUN_TO_COMPLETION_SCHEDULER    1   /* Scheduler type option */
+#define NUSE_TIME_SLICE_SCHEDULER           2   /* Scheduler type option */
+#define NUSE_ROUND_ROBIN_SCHEDULER          3   /* Scheduler type option */
+#define NUSE_PRIORITY_SCHEDULER             4   /* Scheduler type option */
+                                                /* Scheduler type selection: */
+#define NUSE_SCHEDULER_TYPE     NUSE_PRIORITY_SCHEDULER
+
+#define NUSE_TIME_SLICE_TICKS 0                 /* interval for time slice scheduler */
+
+#define NUSE_SCHEDULE_COUNT_SUPPORT FALSE       /* Enables support for schedule counting of each task */
+
+#define NUSE_RUNTIME_SUPPORT        FALSE       /* Enables measurement of the run time of each task */
+#define NUSE_CYCLE_COUNTER()        NUSE_Tick_Clock /* Free running U32 time source - map to a hardware cycle counter */
+
+#define NUSE_STACK_PAINTING         FALSE       /* Enables measurement of task stack usage */
+#define NUSE_STACK_CHECK_SWITCH     FALSE       /* Enables a stack overflow check at each context switch */
+
+#define NUSE_SUSPEND_ENABLE         TRUE        /* Enables support for task suspend */
+#define NUSE_BLOCKING_ENABLE        TRUE        /* Enables blocking API calls */
+
+/*** Trace ***/
+
+#define NUSE_TRACE_SUPPORT          FALSE       /* Enables recording of kernel events in the trace buffer */
+#define NUSE_TRACE_API              FALSE       /* Enables recording of API service call entry and exit */
+#define NUSE_TRACE_SIZE             0           /* Number of records in the trace buffer - a power of 2 */
+#define NUSE_TRACE_TIMESTAMP()      0           /* Free running time source for trace records - e.g. a hardware timer */
+
+/*** Statistics ***/
+
+#define NUSE_WAIT_STATISTICS_SUPPORT FALSE      /* Enables blocking and wait time statistics for each object */
+#define NUSE_WAIT_STATISTICS        FALSE       /* Service call enabler */
+#define NUSE_WAIT_STATISTICS_RESET  FALSE       /* Service call enabler */
+
+#define NUSE_CS_PROFILE_SUPPORT     FALSE       /* Enables measurement of critical section duration */
+#define NUSE_CS_PROFILE_SITES       0           /* Number of critical section exit points recorded */
+#define NUSE_CS_PROFILE_SITE        FALSE       /* Service call enabler */
+#define NUSE_CS_PROFILE_HISTOGRAM   FALSE       /* Service call enabler */
+#define NUSE_CS_PROFILE_RESET       FALSE       /* Service call enabler */
+
+#define NUSE_LATENCY_SUPPORT        FALSE       /* Enables interrupt and context switch latency histograms */
+#define NUSE_LATENCY_HISTOGRAM      FALSE       /* Service call enabler */
+#define NUSE_LATENCY_PERCENTILE     FALSE       /* Service call enabler */
+#define NUSE_LATENCY_RESET          FALSE       /* Service call enabler */
+
+/*** Deadlock detection ***/
+
+#define NUSE_DEADLOCK_DETECTION_SUPPORT FALSE   /* Enables wait-for graph deadlock detection */
+#define NUSE_DEADLOCK_PARTITIONS    FALSE       /* Includes partition pools in deadlock detection */
+#define NUSE_DEADLOCK_INFORMATION   FALSE       /* Service call enabler */
+
+/*** Task watchdog ***/
+
+#define NUSE_WATCHDOG_SUPPORT       FALSE       /* Enables the task liveness watchdog */
+#define NUSE_WATCHDOG_HANDLER(task) NUSE_Watchdog_Reset(task)  /* Called from the clock ISR when a task misses a check-in */
+#define NUSE_WATCHDOG_START         FALSE       /* Service call enabler */
+#define NUSE_WATCHDOG_CHECK_IN      FALSE       /* Service call enabler */
+#define NUSE_WATCHDOG_STOP          FALSE       /* Service call enabler */
+
+#define NUSE_INCLUDE_EVERYTHING     FALSE       /* enable all facilities and APIs - for debug/porting only */
+
+#endif  /* ! _NUSE_CONFIG_H_ */
+
@@ -0,0 +1,80 @@
+#!/bin/sh
+#
+# Nucleus SE kernel scaling benchmark - parameter sweep
+#
+# Builds and runs the benchmark once for each value of one parameter, and
+# writes the results of all the runs to standard output as CSV, ready for
+# tools/nuse_scaling_plot.c:
+#
+#     sweep.sh tasks|timers|partitions [value ...] > results.csv
+#
+# With no values, the parameter is swept from its smallest value to its
+# largest: tasks 1-16, timers 0-16, partitions 1, 2, 4 ... 32768, 65534.
+# The other parameters keep their defaults [see nuse_config.h].
+#
+# Each configuration is built with $BENCH_CC from the kernel sources in src
+# and the files in this directory, then loaded and run by $BENCH_GDB through
+# the debug probe at $BENCH_TARGET. The debugger stops at bench_stop() and
+# prints bench_results[]. Set these for the toolchain and probe in use:
+#
+#     BENCH_CC        compiler [default m68k-elf-gcc]
+#     BENCH_CFLAGS    target options, start-up code, linker script etc.
+#     BENCH_GDB       debugger [default m68k-elf-gdb]
+#     BENCH_TARGET    gdb remote target [default localhost:3333]
+#
+
+BENCH_CC=${BENCH_CC:-m68k-elf-gcc}
+BENCH_GDB=${BENCH_GDB:-m68k-elf-gdb}
+BENCH_TARGET=${BENCH_TARGET:-localhost:3333}
+
+here=$(cd "$(dirname "$0")" && pwd)
+src="$here/../../src"
+
+case "$1" in
+    tasks)      define=BENCH_TASKS;      values="1 2 3 4 5 6 7 8 9 10 11 12 13 14 15 16" ;;
+    timers)     define=BENCH_TIMERS;     values="0 1 2 3 4 5 6 7 8 9 10 11 12 13 14 15 16" ;;
+    partitions) define=BENCH_PARTITIONS; values="1 2 4 8 16 32 64 128 256 512 1024 2048 4096 8192 16384 32768 65534" ;;
+    *)
+        echo "usage: sweep.sh tasks|timers|partitions [value ...]" >&2
+        exit 2
+        ;;
+esac
+shift
+if [ $# -gt 0 ]; then
+    values="$*"
+fi
+
+# build in a copy of the kernel, with the benchmark's configuration in place of src's
+
+work=$(mktemp -d) || exit 1
+trap 'rm -rf "$work"' EXIT
+cp "$src"/*.c "$src"/*.h "$work" || exit 1
+cp "$here"/*.c "$here"/*.h "$work" || exit 1
+
+for n in $values
+do
+    echo "sweep: $define=$n" >&2
+
+    if ! $BENCH_CC $BENCH_CFLAGS -g -D$define=$n -I"$work" -o "$work/bench.elf" "$work"/*.c
+    then
+        echo "sweep: build failed for $define=$n" >&2
+        exit 1
+    fi
+
+    $BENCH_GDB -batch -nx "$work/bench.elf" \
+        -ex "target remote $BENCH_TARGET" \
+        -ex "load" \
+        -ex "break bench_stop" \
+        -ex "continue" \
+        -ex 'printf "%s", bench_results' \
+        > "$work/run.txt" 2>&1
+
+    # keep only the result lines - tasks,timers,partitions,test,count,cycles
+
+    if ! grep '^[0-9]*,[0-9]*,[0-9]*,[a-z]*,[0-9]*,[0-9]*$' "$work/run.txt"
+    then
+        echo "sweep: no results for $define=$n - debugger output:" >&2
+        cat "$work/run.txt" >&2
+        exit 1
+    fi
+done
@@ -17,6 +17,7 @@
 #include "nuse_prototypes.h"
 #include "nuse_codes.h"
 #include "nuse_binary.h"
+#include "nuse_trace.h"
 
 /* Nucleus API Definition */
 
@@ -106,6 +107,34 @@
 
 #endif
 
+/* Dynamic Memory */
+
+#if NU_ESTABLISHED_MEMORY_POOLS || NUSE_INCLUDE_EVERYTHING
+    #define NU_Established_Memory_Pools() \
+        NUSE_Memory_Pool_Count()
+#endif
+
+#if NUSE_MEMORY_POOL_NUMBER > 0
+
+    #if NU_ALLOCATE_MEMORY || NUSE_INCLUDE_EVERYTHING
+        #define NU_Allocate_Memory(pool, return_pointer, size, suspend) \
+            NUSE_Memory_Allocate(pool, return_pointer, size, suspend)
+    #endif
+
+    #if NU_DEALLOCATE_MEMORY || NUSE_INCLUDE_EVERYTHING
+        #define NU_Deallocate_Memory(memory) \
+            NUSE_Memory_Deallocate(memory)
+    #endif
+
+    #if NU_MEMORY_POOL_INFORMATION || NUSE_INCLUDE_EVERYTHING
+        #define NU_Memory_Pool_Information(pool, name, start_address, pool_size, min_allocation, available, suspend_type, tasks_waiting, first_task) \
+            NUSE_Memory_Pool_Information(pool, start_address, pool_size, min_allocation, available, tasks_waiting, first_task), \
+            (*name = 0), \
+            (*suspend_type = NU_PRIORITY)
+    #endif
+
+#endif
+
 /* Mailboxes */
 
 #if NU_ESTABLISHED_MAILBOXES || NUSE_INCLUDE_EVERYTHING
@@ -148,6 +177,11 @@
 
 #if NUSE_QUEUE_NUMBER > 0
 
+    #if NU_BROADCAST_TO_QUEUE || NUSE_INCLUDE_EVERYTHING
+        #define NU_Broadcast_To_Queue(queue, message, size, suspend) \
+            NUSE_Queue_Broadcast(queue, message, suspend)
+    #endif
+
     #if NU_QUEUE_INFORMATION || NUSE_INCLUDE_EVERYTHING
         #define NU_Queue_Information(queue, name, start_address, queue_size, available, messages, message_type, message_size, suspend_type, tasks_waiting, first_task) \
             NUSE_Queue_Information(queue, start_address, queue_size, available, messages, tasks_waiting, first_task), \
@@ -189,6 +223,11 @@
 
 #if NUSE_PIPE_NUMBER > 0
 
+    #if NU_BROADCAST_TO_PIPE || NUSE_INCLUDE_EVERYTHING
+        #define NU_Broadcast_To_Pipe(pipe, message, size, suspend) \
+            NUSE_Pipe_Broadcast(pipe, message, size, suspend)
+    #endif
+
     #if NU_PIPE_INFORMATION || NUSE_INCLUDE_EVERYTHING
         #define NU_Pipe_Information(pipe, name, start_address, pipe_size, available, messages, message_type, message_size, suspend_type, tasks_waiting, first_task) \
             NUSE_Pipe_Information(pipe, start_address, pipe_size, available, messages, message_size, tasks_waiting, first_task), \
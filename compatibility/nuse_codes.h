@@ -36,10 +36,12 @@
 #define NU_EVENT_SUSPEND (7)
 #define NU_SEMAPHORE_SUSPEND (6)
 #define NU_PARTITION_SUSPEND (8)
+#define NU_MEMORY_SUSPEND (15)
 
 #define NU_INVALID_POOL (-16)
 #define NU_INVALID_POINTER (-15)
 #define NU_NO_PARTITION (-34)
+#define NU_NO_MEMORY (-32)
 #define NU_TIMEOUT (-50)
 
 #define NU_INVALID_MAILBOX (-10)
@@ -86,5 +88,15 @@
 #define NUSE_NISR (2)
 #define NUSE_MISR (3)
 
+/* Trace record event types - 0 marks an unused record */
+#define NUSE_TRACE_SWITCH (1)
+#define NUSE_TRACE_WAKE (2)
+#define NUSE_TRACE_SUSPEND (3)
+#define NUSE_TRACE_API_ENTRY (4)
+#define NUSE_TRACE_API_EXIT (5)
+#define NUSE_TRACE_ISR_ENTRY (6)
+#define NUSE_TRACE_ISR_EXIT (7)
+#define NUSE_TRACE_TIMER (8)
+
 #endif  /* ! _NUSE_CODES_H_ */
 
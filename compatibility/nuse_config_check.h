@@ -63,10 +63,26 @@
 #endif
 
 
-/*** Dynamic memory [not implemented] ***/
+/*** Dynamic memory ***/
+
+#if NUSE_MEMORY_POOL_NUMBER > 16
+    #error NUSE: invalid number of memory pools - must be 0-16
+#endif
+
+#if NUSE_MEMORY_POOL_NUMBER == 0
+
+    #if NU_ALLOCATE_MEMORY
+        #error NUSE: NU_Allocate_Memory() enabled - no memory pools configured
+    #endif
+
+    #if NU_DEALLOCATE_MEMORY
+        #error NUSE: NU_Deallocate_Memory() enabled - no memory pools configured
+    #endif
+
+    #if NU_MEMORY_POOL_INFORMATION
+        #error NUSE: NU_Memory_Pool_Information() enabled - no memory pools configured
+    #endif
 
-#if NU_ALLOCATE_MEMORY
-    #error NUSE: NU_Allocate_Memory() API not implemented
 #endif
 
 #if NU_ALLOCATE_ALIGNED_MEMORY
@@ -77,22 +93,10 @@
     #error NUSE: NU_Create_Memory_Pool() API not implemented
 #endif
 
-#if NU_DEALLOCATE_MEMORY
-    #error NUSE: NU_Deallocate_Memory() API not implemented
-#endif
-
 #if NU_DELETE_MEMORY_POOL
     #error NUSE: NU_Delete_Memory_Pool() API not implemented
 #endif
 
-#if NU_ESTABLISHED_MEMORY_POOLS
-    #error NUSE: NU_Established_Memory_Pools() API not implemented
-#endif
-
-#if NU_MEMORY_POOL_INFORMATION
-    #error NUSE: NU_Memory_Pool_Information() API not implemented
-#endif
-
 #if NU_MEMORY_POOL_POINTERS
     #error NUSE: NU_Memory_Pool_Pointers() API not implemented
 #endif
@@ -181,6 +185,10 @@
 
 #if NUSE_QUEUE_NUMBER == 0
 
+    #if NU_BROADCAST_TO_QUEUE
+        #error NUSE: NU_Broadcast_To_Queue() enabled - no queues configured
+    #endif
+
     #if NU_QUEUE_INFORMATION
         #error NUSE: NU_Queue_Information() enabled - no queues configured
     #endif
@@ -207,10 +215,6 @@
     #error NUSE: NU_Queue_Pointers() API not implemented
 #endif
 
-#if NU_BROADCAST_TO_QUEUE
-    #error NUSE: NU_Broadcast_To_Queue() API not implemented
-#endif
-
 #if NU_CREATE_QUEUE
     #error NUSE: NU_Create_Queue() API not implemented
 #endif
@@ -227,6 +231,10 @@
 
 #if NUSE_PIPE_NUMBER == 0
 
+    #if NU_BROADCAST_TO_PIPE
+        #error NUSE: NU_Broadcast_To_Pipe() enabled - no pipes configured
+    #endif
+
     #if NU_PIPE_INFORMATION
         #error NUSE: NU_Pipe_Information() enabled - no pipes configured
     #endif
@@ -253,10 +261,6 @@
     #error NUSE: NU_Pipe_Pointers() API not implemented
 #endif
 
-#if NU_BROADCAST_TO_PIPE
-    #error NUSE: NU_Broadcast_To_Pipe() API not implemented
-#endif
-
 #if NU_CREATE_PIPE
     #error NUSE: NU_Create_Pipe() API not implemented
 #endif
@@ -271,6 +275,10 @@
     #error NUSE: invalid number of semaphores - must be 0-16
 #endif
 
+#if (NUSE_SEMAPHORE_WIDTH != 8) && (NUSE_SEMAPHORE_WIDTH != 16) && (NUSE_SEMAPHORE_WIDTH != 32)
+    #error NUSE: invalid semaphore width - must be 8, 16 or 32
+#endif
+
 #if NUSE_SEMAPHORE_NUMBER == 0
 
     #if NU_OBTAIN_SEMAPHORE
@@ -309,6 +317,10 @@
     #error NUSE: invalid number of event groups - must be 0-16
 #endif
 
+#if (NUSE_EVENT_GROUP_WIDTH != 8) && (NUSE_EVENT_GROUP_WIDTH != 16) && (NUSE_EVENT_GROUP_WIDTH != 32)
+    #error NUSE: invalid event group width - must be 8, 16 or 32
+#endif
+
 #if NUSE_EVENT_GROUP_NUMBER == 0
 
     #if NU_EVENT_GROUP_INFORMATION
@@ -552,5 +564,142 @@
     #error NUSE: blocking API calls enabled with RTC scheduler - not supported
 #endif
 
+#if NUSE_STACK_PAINTING && (NUSE_SCHEDULER_TYPE == NUSE_RUN_TO_COMPLETION_SCHEDULER)
+    #error NUSE: stack painting enabled with RTC scheduler - tasks do not have their own stacks
+#endif
+
+#if NUSE_STACK_CHECK_SWITCH && !NUSE_STACK_PAINTING
+    #error NUSE: stack check at context switch enabled - stack painting not enabled
+#endif
+
+#if NUSE_TASK_STACK_HIGH_WATER && !NUSE_STACK_PAINTING
+    #error NUSE: NUSE_Task_Stack_High_Water() enabled - stack painting not enabled
+#endif
+
+#if NUSE_TASK_RUNTIME && !NUSE_RUNTIME_SUPPORT
+    #error NUSE: NUSE_Task_Runtime() enabled - run time accounting not enabled
+#endif
+
+#if NUSE_TASK_LOAD && !NUSE_RUNTIME_SUPPORT
+    #error NUSE: NUSE_Task_Load() enabled - run time accounting not enabled
+#endif
+
+#if NUSE_TASK_RUNTIME_RESET && !NUSE_RUNTIME_SUPPORT
+    #error NUSE: NUSE_Task_Runtime_Reset() enabled - run time accounting not enabled
+#endif
+
+/*** Trace ***/
+
+#if NUSE_TRACE_SUPPORT
+    #if (NUSE_TRACE_SIZE == 0) || (NUSE_TRACE_SIZE & (NUSE_TRACE_SIZE - 1)) || (NUSE_TRACE_SIZE > 32768)
+        #error NUSE: invalid trace buffer size - must be a power of 2, up to 32768
+    #endif
+#endif
+
+#if NUSE_TRACE_API && !NUSE_TRACE_SUPPORT
+    #error NUSE: API call tracing enabled - trace support not enabled
+#endif
+
+/*** Statistics ***/
+
+#if NUSE_WAIT_STATISTICS_SUPPORT
+    #if !NUSE_BLOCKING_ENABLE
+        #error NUSE: wait statistics enabled - blocking not enabled
+    #endif
+    #if (NUSE_QUEUE_NUMBER + NUSE_PIPE_NUMBER + NUSE_MAILBOX_NUMBER + NUSE_SEMAPHORE_NUMBER + NUSE_EVENT_GROUP_NUMBER + NUSE_PARTITION_POOL_NUMBER) == 0
+        #error NUSE: wait statistics enabled - no objects on which tasks may block
+    #endif
+#endif
+
+#if NUSE_WAIT_STATISTICS && !NUSE_WAIT_STATISTICS_SUPPORT
+    #error NUSE: NUSE_Wait_Statistics() enabled - wait statistics not enabled
+#endif
+
+#if NUSE_WAIT_STATISTICS_RESET && !NUSE_WAIT_STATISTICS_SUPPORT
+    #error NUSE: NUSE_Wait_Statistics_Reset() enabled - wait statistics not enabled
+#endif
+
+#if NUSE_CS_PROFILE_SUPPORT
+    #if (NUSE_CS_PROFILE_SITES == 0) || (NUSE_CS_PROFILE_SITES > 255)
+        #error NUSE: invalid number of critical section profile entries - must be 1-255
+    #endif
+#endif
+
+#if NUSE_CS_PROFILE_SITE && !NUSE_CS_PROFILE_SUPPORT
+    #error NUSE: NUSE_CS_Profile_Site() enabled - critical section profiling not enabled
+#endif
+
+#if NUSE_CS_PROFILE_HISTOGRAM && !NUSE_CS_PROFILE_SUPPORT
+    #error NUSE: NUSE_CS_Profile_Histogram() enabled - critical section profiling not enabled
+#endif
+
+#if NUSE_CS_PROFILE_RESET && !NUSE_CS_PROFILE_SUPPORT
+    #error NUSE: NUSE_CS_Profile_Reset() enabled - critical section profiling not enabled
+#endif
+
+#if NUSE_LATENCY_SUPPORT
+    #if NUSE_SCHEDULER_TYPE == NUSE_RUN_TO_COMPLETION_SCHEDULER
+        #error NUSE: latency measurement enabled with RTC scheduler - there is no context switch
+    #endif
+    #if !NUSE_SUSPEND_ENABLE
+        #error NUSE: latency measurement enabled - task suspend not enabled
+    #endif
+#endif
+
+#if NUSE_LATENCY_HISTOGRAM && !NUSE_LATENCY_SUPPORT
+    #error NUSE: NUSE_Latency_Histogram() enabled - latency measurement not enabled
+#endif
+
+#if NUSE_LATENCY_PERCENTILE && !NUSE_LATENCY_SUPPORT
+    #error NUSE: NUSE_Latency_Percentile() enabled - latency measurement not enabled
+#endif
+
+#if NUSE_LATENCY_RESET && !NUSE_LATENCY_SUPPORT
+    #error NUSE: NUSE_Latency_Reset() enabled - latency measurement not enabled
+#endif
+
+#if NUSE_DEADLOCK_DETECTION_SUPPORT
+    #if !NUSE_BLOCKING_ENABLE
+        #error NUSE: deadlock detection enabled - blocking not enabled
+    #endif
+    #if (NUSE_SEMAPHORE_NUMBER + NUSE_BINARY_SEMAPHORE_NUMBER + NUSE_PARTITION_POOL_NUMBER) == 0
+        #error NUSE: deadlock detection enabled - no objects which tasks may hold
+    #endif
+#endif
+
+#if NUSE_DEADLOCK_PARTITIONS
+    #if !NUSE_DEADLOCK_DETECTION_SUPPORT
+        #error NUSE: partition pool deadlock detection enabled - deadlock detection not enabled
+    #endif
+    #if NUSE_PARTITION_POOL_NUMBER == 0
+        #error NUSE: partition pool deadlock detection enabled - no partition pools configured
+    #endif
+#endif
+
+#if NUSE_DEADLOCK_INFORMATION && !NUSE_DEADLOCK_DETECTION_SUPPORT
+    #error NUSE: NUSE_Deadlock_Information() enabled - deadlock detection not enabled
+#endif
+
+#if NUSE_WATCHDOG_SUPPORT
+    #if NUSE_SCHEDULER_TYPE == NUSE_RUN_TO_COMPLETION_SCHEDULER
+        #error NUSE: task watchdog enabled with RTC scheduler - a task cannot be reset
+    #endif
+    #if !NUSE_SUSPEND_ENABLE
+        #error NUSE: task watchdog enabled - task suspend not enabled
+    #endif
+#endif
+
+#if NUSE_WATCHDOG_START && !NUSE_WATCHDOG_SUPPORT
+    #error NUSE: NUSE_Watchdog_Start() enabled - task watchdog not enabled
+#endif
+
+#if NUSE_WATCHDOG_CHECK_IN && !NUSE_WATCHDOG_SUPPORT
+    #error NUSE: NUSE_Watchdog_Check_In() enabled - task watchdog not enabled
+#endif
+
+#if NUSE_WATCHDOG_STOP && !NUSE_WATCHDOG_SUPPORT
+    #error NUSE: NUSE_Watchdog_Stop() enabled - task watchdog not enabled
+#endif
+
 #endif  /* ! _NUSE_CONFIG_CHECK_H_ */
 
@@ -15,6 +15,8 @@
 #ifndef _NUSE_TYPES_H_
 #define _NUSE_TYPES_H_
 
+#include "nuse_config.h"
+
 
 /* Data types used by Nucleus SE - these may need to be adjusted for different compilers/CPUs */
 
@@ -29,6 +31,7 @@ typedef U8 OPTION;              /* service call option parameter value */
 
 typedef U8 NU_TASK;             /* kernel object index data types */
 typedef U8 NU_PARTITION_POOL;
+typedef U8 NU_MEMORY_POOL;
 typedef U8 NU_MAILBOX;
 typedef U8 NU_QUEUE;
 typedef U8 NU_PIPE;
@@ -55,15 +58,36 @@ typedef void (*PF2)(U8, ADDR);
 
 /*** CPU specfics ***/
 
-/* Critical section delimiters */
+/* Critical section delimiters - if profiling is configured, the time for which */
+/* interrupts are masked is recorded against the exit point */
+
+#if NUSE_CS_PROFILE_SUPPORT
+
+    #define NUSE_CS_Enter()                             \
+        if (NUSE_Task_State == NUSE_TASK)               \
+        {                                               \
+            asm(" move.w #$2700,sr");                   \
+            NUSE_CS_Profile_Enter();                    \
+        }
+
+    #define NUSE_CS_Exit()                              \
+        if (NUSE_Task_State == NUSE_TASK)               \
+        {                                               \
+            NUSE_CS_Profile_Exit(__FILE__, __LINE__);   \
+            asm(" move.w #$2000,sr");                   \
+        }
 
-#define NUSE_CS_Enter()                 \
-    if (NUSE_Task_State == NUSE_TASK)   \
-        asm(" move.w #$2700,sr");
+#else
 
-#define NUSE_CS_Exit()                  \
-    if (NUSE_Task_State == NUSE_TASK)   \
-        asm(" move.w #$2000,sr");
+    #define NUSE_CS_Enter()                 \
+        if (NUSE_Task_State == NUSE_TASK)   \
+            asm(" move.w #$2700,sr");
+
+    #define NUSE_CS_Exit()                  \
+        if (NUSE_Task_State == NUSE_TASK)   \
+            asm(" move.w #$2000,sr");
+
+#endif
 
 #define NUSE_REGISTERS          18
 #define NUSE_STATUS_REGISTER    ((ADDR)0x40002000)
@@ -73,14 +97,28 @@ typedef void (*PF2)(U8, ADDR);
 
 /* Interrupt Service Routine Support */
 
+#if NUSE_TRACE_SUPPORT
+    #define NUSE_TRACE_ISR(event) NUSE_Trace_ISR(event);
+#else
+    #define NUSE_TRACE_ISR(event)
+#endif
+
+#if NUSE_LATENCY_SUPPORT
+    #define NUSE_LATENCY_ISR() NUSE_Latency_ISR();
+#else
+    #define NUSE_LATENCY_ISR()
+#endif
+
 /* Native interrupts */
 
 #define NUSE_NISR_Enter() \
 static U8 NUSE_Old_Task_State; \
 NUSE_Old_Task_State = NUSE_Task_State; \
-NUSE_Task_State = NUSE_NISR;
+NUSE_Task_State = NUSE_NISR; \
+NUSE_TRACE_ISR(NUSE_TRACE_ISR_ENTRY)
 
 #define NUSE_NISR_Exit() \
+NUSE_TRACE_ISR(NUSE_TRACE_ISR_EXIT) \
 NUSE_Task_State = NUSE_Old_Task_State;
 
 /* Managed interrupts */
@@ -109,7 +147,10 @@ asm(" move.l (sp)+,(a0)+"); \
 asm(" move.l sp,(a0)"); \
 NUSE_Task_Saved_State = NUSE_Task_State; \
 NUSE_Task_State = NUSE_MISR; \
+NUSE_LATENCY_ISR() \
+NUSE_TRACE_ISR(NUSE_TRACE_ISR_ENTRY) \
 isrcode(); \
+NUSE_TRACE_ISR(NUSE_TRACE_ISR_EXIT) \
 NUSE_Task_State = NUSE_Task_Saved_State; \
 asm(" lea _NUSE_Task_Context,a0"); \
 asm(" clr d0"); \
@@ -32,24 +32,45 @@
 #define NUSE_TASK_RESET         TRUE            /* Service call enabler */
 #define NUSE_TASK_INFORMATION   TRUE            /* Service call enabler */
 #define NUSE_TASK_COUNT         TRUE            /* Service call enabler */
+#define NUSE_TASK_WAIT_MULTIPLE TRUE            /* Service call enabler */
+#define NUSE_TASK_STACK_HIGH_WATER TRUE         /* Service call enabler */
+#define NUSE_TASK_RUNTIME       TRUE            /* Service call enabler */
+#define NUSE_TASK_LOAD          TRUE            /* Service call enabler */
+#define NUSE_TASK_RUNTIME_RESET TRUE            /* Service call enabler */
 
 #define NUSE_INITIAL_TASK_STATE_SUPPORT TRUE    /* Enables support for tasks starting as suspended */
 
 /*** Partition pools ***/
 
 #define NUSE_PARTITION_POOL_NUMBER      1       /* Number of partition pools in the system - 0-16 */
+#define NUSE_PARTITION_ALIGNMENT        4       /* Partition alignment in bytes - 0 [status byte before each partition] or a power of 2 */
+#define NUSE_PARTITION_COUNT_WIDTH      8       /* Partition count size in bits - 8 [up to 254 partitions per pool] or 16 */
 
 #define NUSE_PARTITION_ALLOCATE         TRUE    /* Service call enabler */
+#define NUSE_PARTITION_ALLOCATE_SIZE    TRUE    /* Service call enabler */
 #define NUSE_PARTITION_DEALLOCATE       TRUE    /* Service call enabler */
+#define NUSE_PARTITION_REFERENCE        TRUE    /* Service call enabler */
+#define NUSE_PARTITION_SEND             TRUE    /* Service call enabler */
 #define NUSE_PARTITION_POOL_INFORMATION TRUE    /* Service call enabler */
+#define NUSE_PARTITION_POOL_STATISTICS  TRUE    /* Service call enabler */
 #define NUSE_PARTITION_POOL_COUNT       TRUE    /* Service call enabler */
 
+/*** Memory pools ***/
+
+#define NUSE_MEMORY_POOL_NUMBER         1       /* Number of memory pools in the system - 0-16 */
+
+#define NUSE_MEMORY_ALLOCATE            TRUE    /* Service call enabler */
+#define NUSE_MEMORY_DEALLOCATE          TRUE    /* Service call enabler */
+#define NUSE_MEMORY_POOL_INFORMATION    TRUE    /* Service call enabler */
+#define NUSE_MEMORY_POOL_COUNT          TRUE    /* Service call enabler */
+
 /*** Mailboxes ***/
 
 #define NUSE_MAILBOX_NUMBER         1           /* Number of mailboxes in the system - 0-16 */
 
 #define NUSE_MAILBOX_SEND           TRUE        /* Service call enabler */
 #define NUSE_MAILBOX_RECEIVE        TRUE        /* Service call enabler */
+#define NUSE_MAILBOX_OVERWRITE      TRUE        /* Service call enabler */
 #define NUSE_MAILBOX_RESET          TRUE        /* Service call enabler */
 #define NUSE_MAILBOX_INFORMATION    TRUE        /* Service call enabler */
 #define NUSE_MAILBOX_COUNT          TRUE        /* Service call enabler */
@@ -61,6 +82,7 @@
 #define NUSE_QUEUE_SEND         TRUE            /* Service call enabler */
 #define NUSE_QUEUE_RECEIVE      TRUE            /* Service call enabler */
 #define NUSE_QUEUE_JAM          TRUE            /* Service call enabler */
+#define NUSE_QUEUE_BROADCAST    TRUE            /* Service call enabler */
 #define NUSE_QUEUE_RESET        TRUE            /* Service call enabler */
 #define NUSE_QUEUE_INFORMATION  TRUE            /* Service call enabler */
 #define NUSE_QUEUE_COUNT        TRUE            /* Service call enabler */
@@ -72,13 +94,33 @@
 #define NUSE_PIPE_SEND          TRUE            /* Service call enabler */
 #define NUSE_PIPE_RECEIVE       TRUE            /* Service call enabler */
 #define NUSE_PIPE_JAM           TRUE            /* Service call enabler */
+#define NUSE_PIPE_BROADCAST     TRUE            /* Service call enabler */
 #define NUSE_PIPE_RESET         TRUE            /* Service call enabler */
 #define NUSE_PIPE_INFORMATION   TRUE            /* Service call enabler */
 #define NUSE_PIPE_COUNT         TRUE            /* Service call enabler */
 
+/*** Channels ***/
+
+#define NUSE_CHANNEL_NUMBER     1               /* Number of channels in the system - 0-16 */
+
+#define NUSE_CHANNEL_PUT        TRUE            /* Service call enabler */
+#define NUSE_CHANNEL_GET        TRUE            /* Service call enabler */
+#define NUSE_CHANNEL_INFORMATION TRUE           /* Service call enabler */
+#define NUSE_CHANNEL_COUNT      TRUE            /* Service call enabler */
+
+/*** State Boards ***/
+
+#define NUSE_BOARD_NUMBER       1               /* Number of state boards in the system - 0-16 */
+
+#define NUSE_BOARD_WRITE        TRUE            /* Service call enabler */
+#define NUSE_BOARD_READ         TRUE            /* Service call enabler */
+#define NUSE_BOARD_INFORMATION  TRUE            /* Service call enabler */
+#define NUSE_BOARD_COUNT        TRUE            /* Service call enabler */
+
 /*** Semaphores ***/
 
 #define NUSE_SEMAPHORE_NUMBER       1           /* Number of semaphores in the system - 0-16 */
+#define NUSE_SEMAPHORE_WIDTH        16          /* Semaphore counter size in bits - 8, 16 or 32 */
 
 #define NUSE_SEMAPHORE_OBTAIN       TRUE        /* Service call enabler */
 #define NUSE_SEMAPHORE_RELEASE      TRUE        /* Service call enabler */
@@ -86,9 +128,16 @@
 #define NUSE_SEMAPHORE_INFORMATION  TRUE        /* Service call enabler */
 #define NUSE_SEMAPHORE_COUNT        TRUE        /* Service call enabler */
 
+#define NUSE_BINARY_SEMAPHORE_NUMBER    1       /* Number of binary semaphores in the system - 0-16 */
+
+#define NUSE_BINARY_SEMAPHORE_OBTAIN    TRUE    /* Service call enabler */
+#define NUSE_BINARY_SEMAPHORE_RELEASE   TRUE    /* Service call enabler */
+#define NUSE_BINARY_SEMAPHORE_COUNT     TRUE    /* Service call enabler */
+
 /*** Event groups ***/
 
 #define NUSE_EVENT_GROUP_NUMBER         1       /* Number of event groups in the system - 0-16 */
+#define NUSE_EVENT_GROUP_WIDTH          32      /* Number of flags in each event group - 8, 16 or 32 */
 
 #define NUSE_EVENT_GROUP_SET            TRUE    /* Service call enabler */
 #define NUSE_EVENT_GROUP_RETRIEVE       TRUE    /* Service call enabler */
@@ -101,6 +150,7 @@
 
 #define NUSE_SIGNALS_SEND       TRUE            /* Service call enabler */
 #define NUSE_SIGNALS_RECEIVE    TRUE            /* Service call enabler */
+#define NUSE_SIGNALS_WAIT       TRUE            /* Service call enabler */
 
 /*** Timers ***/
 
@@ -138,9 +188,53 @@
 
 #define NUSE_SCHEDULE_COUNT_SUPPORT TRUE        /* Enables support for schedule counting of each task */
 
+#define NUSE_RUNTIME_SUPPORT        TRUE        /* Enables measurement of the run time of each task */
+#define NUSE_CYCLE_COUNTER()        NUSE_Tick_Clock /* Free running U32 time source - e.g. a hardware cycle counter */
+
+#define NUSE_STACK_PAINTING         TRUE        /* Enables measurement of task stack usage */
+#define NUSE_STACK_CHECK_SWITCH     TRUE        /* Enables a stack overflow check at each context switch */
+
 #define NUSE_SUSPEND_ENABLE         TRUE        /* Enables support for task suspend */
 #define NUSE_BLOCKING_ENABLE        TRUE        /* Enables blocking API calls */
 
+/*** Trace ***/
+
+#define NUSE_TRACE_SUPPORT          TRUE        /* Enables recording of kernel events in the trace buffer */
+#define NUSE_TRACE_API              TRUE        /* Enables recording of API service call entry and exit */
+#define NUSE_TRACE_SIZE             64          /* Number of records in the trace buffer - a power of 2 */
+#define NUSE_TRACE_TIMESTAMP()      NUSE_Tick_Clock /* Free running time source for trace records - e.g. a hardware timer */
+
+/*** Statistics ***/
+
+#define NUSE_WAIT_STATISTICS_SUPPORT TRUE       /* Enables blocking and wait time statistics for each object */
+#define NUSE_WAIT_STATISTICS        TRUE        /* Service call enabler */
+#define NUSE_WAIT_STATISTICS_RESET  TRUE        /* Service call enabler */
+
+#define NUSE_CS_PROFILE_SUPPORT     TRUE        /* Enables measurement of critical section duration */
+#define NUSE_CS_PROFILE_SITES       32          /* Number of critical section exit points recorded */
+#define NUSE_CS_PROFILE_SITE        TRUE        /* Service call enabler */
+#define NUSE_CS_PROFILE_HISTOGRAM   TRUE        /* Service call enabler */
+#define NUSE_CS_PROFILE_RESET       TRUE        /* Service call enabler */
+
+#define NUSE_LATENCY_SUPPORT        TRUE        /* Enables interrupt and context switch latency histograms */
+#define NUSE_LATENCY_HISTOGRAM      TRUE        /* Service call enabler */
+#define NUSE_LATENCY_PERCENTILE     TRUE        /* Service call enabler */
+#define NUSE_LATENCY_RESET          TRUE        /* Service call enabler */
+
+/*** Deadlock detection ***/
+
+#define NUSE_DEADLOCK_DETECTION_SUPPORT TRUE    /* Enables wait-for graph deadlock detection */
+#define NUSE_DEADLOCK_PARTITIONS    TRUE        /* Includes partition pools in deadlock detection */
+#define NUSE_DEADLOCK_INFORMATION   TRUE        /* Service call enabler */
+
+/*** Task watchdog ***/
+
+#define NUSE_WATCHDOG_SUPPORT       TRUE        /* Enables the task liveness watchdog */
+#define NUSE_WATCHDOG_HANDLER(task) NUSE_Watchdog_Reset(task)  /* Called from the clock ISR when a task misses a check-in */
+#define NUSE_WATCHDOG_START         TRUE        /* Service call enabler */
+#define NUSE_WATCHDOG_CHECK_IN      TRUE        /* Service call enabler */
+#define NUSE_WATCHDOG_STOP          TRUE        /* Service call enabler */
+
 #define NUSE_INCLUDE_EVERYTHING     TRUE        /* enable all facilities and APIs - for debug/porting only */
 
 #endif  /* ! _NUSE_CONFIG_H_ */
@@ -18,10 +18,8 @@ void task1(void)
 
     while (TRUE)
     {
-        sig = NUSE_Signals_Receive();
-        if (sig == 0)
-            NUSE_Task_Sleep(10);
-        else
+        sig = NUSE_Signals_Wait(1, NUSE_SUSPEND);
+        if (sig != 0)
             ret = NUSE_Task_Resume(0);
     }
 }
@@ -64,6 +64,11 @@ ROM ADDR NUSE_Task_Start_Address[NUSE_TASK_NUMBER] =
 
     /* need to declare/define the partition pool RAM space here - array of type U8 */
     /* size in bytes must be (number or partitions * (partition size + 1)) */
+    /* or, if NUSE_PARTITION_ALIGNMENT is not 0, (number of partitions * partition size rounded up to the alignment) */
+    /* and the pool must start on an aligned address */
+    /* and the free list - array of type NUSE_PARTITION_COUNT, one entry per partition */
+    /* and, if NUSE_Partition_Reference() or NUSE_Partition_Send() is used, the reference counts - array of type U8, one entry per partition */
+    /* number of partitions in each pool must be 1-254, or 1-65534 if NUSE_PARTITION_COUNT_WIDTH is 16 */
 
     /* Partition Pool ROM Data */
 
@@ -72,7 +77,7 @@ ROM ADDR NUSE_Task_Start_Address[NUSE_TASK_NUMBER] =
         /* address of partition pools ------ */
     };
 
-    ROM U8 NUSE_Partition_Pool_Partition_Number[NUSE_PARTITION_POOL_NUMBER] =
+    ROM NUSE_PARTITION_COUNT NUSE_Partition_Pool_Partition_Number[NUSE_PARTITION_POOL_NUMBER] =
     {
         /* number of partitions in each pool ------ */
     };
@@ -83,6 +88,42 @@ ROM ADDR NUSE_Task_Start_Address[NUSE_TASK_NUMBER] =
         /* in bytes */
     };
 
+    ROM NUSE_PARTITION_COUNT *NUSE_Partition_Pool_Free_List[NUSE_PARTITION_POOL_NUMBER] =
+    {
+        /* addresses of partition pool free lists ------ */
+    };
+
+    #if NUSE_PARTITION_REFERENCE || NUSE_PARTITION_SEND || NUSE_INCLUDE_EVERYTHING
+
+        ROM U8 *NUSE_Partition_Pool_References[NUSE_PARTITION_POOL_NUMBER] =
+        {
+            /* addresses of partition pool reference counts ------ */
+        };
+
+    #endif
+
+#endif
+
+/*** Memory Pool data ***/
+
+#if NUSE_MEMORY_POOL_NUMBER > 0
+
+    /* need to declare/define the memory pool RAM space here - array of type U32 */
+    /* so that the pool is aligned; size in bytes must be 8-65532 */
+
+    /* Memory Pool ROM Data */
+
+    ROM ADDR NUSE_Memory_Pool_Data_Address[NUSE_MEMORY_POOL_NUMBER] =
+    {
+        /* address of memory pools ------ */
+    };
+
+    ROM U16 NUSE_Memory_Pool_Size[NUSE_MEMORY_POOL_NUMBER] =
+    {
+        /* memory pool sizes ------ */
+        /* in bytes */
+    };
+
 #endif
 
 /*** Queue Data ***/
@@ -133,19 +174,74 @@ ROM ADDR NUSE_Task_Start_Address[NUSE_TASK_NUMBER] =
 
 #endif
 
+/*** Channel Data ***/
+
+#if NUSE_CHANNEL_NUMBER > 0
+
+    /* need to declare/define the channel RAM space here - array of type ADDR */
+    /* array size is the channel size [at least 2]; a channel holds up to (channel size - 1) messages */
+
+    /* Channel ROM Data */
+
+    ROM ADDR *NUSE_Channel_Data[NUSE_CHANNEL_NUMBER] =
+    {
+        /* addresses of channel data areas ------ */
+    };
+
+    ROM U8 NUSE_Channel_Size[NUSE_CHANNEL_NUMBER] =
+    {
+        /* channel sizes ------ */
+    };
+
+#endif
+
+/*** State Board Data ***/
+
+#if NUSE_BOARD_NUMBER > 0
+
+    /* need to declare/define the state board RAM space here - array of type U8 */
+    /* array size is twice the record size, as the board holds two copies of the record */
+
+    /* State Board ROM Data */
+
+    ROM U8 *NUSE_Board_Data[NUSE_BOARD_NUMBER] =
+    {
+        /* addresses of state board data areas ------ */
+    };
+
+    ROM U8 NUSE_Board_Size[NUSE_BOARD_NUMBER] =
+    {
+        /* state board record sizes ------ */
+    };
+
+#endif
+
 /*** Semaphore Data ***/
 
 #if NUSE_SEMAPHORE_NUMBER > 0
 
     /* Semaphore ROM Data */
 
-    ROM U8 NUSE_Semaphore_Initial_Value[NUSE_SEMAPHORE_NUMBER] =
+    ROM NUSE_SEMAPHORE_COUNTER NUSE_Semaphore_Initial_Value[NUSE_SEMAPHORE_NUMBER] =
     {
         /* semaphore initial count values */
     };
 
 #endif
 
+/*** Binary Semaphore Data ***/
+
+#if NUSE_BINARY_SEMAPHORE_NUMBER > 0
+
+    /* Binary Semaphore ROM Data */
+
+    ROM U8 NUSE_Binary_Semaphore_Initial_Value[NUSE_BINARY_SEMAPHORE_NUMBER] =
+    {
+        /* binary semaphore initial states - TRUE if available */
+    };
+
+#endif
+
 /*** Timer Data ***/
 
 #if NUSE_TIMER_NUMBER > 0
@@ -32,24 +32,45 @@
 #define NUSE_TASK_RESET         FALSE           /* Service call enabler */
 #define NUSE_TASK_INFORMATION   FALSE           /* Service call enabler */
 #define NUSE_TASK_COUNT         FALSE           /* Service call enabler */
+#define NUSE_TASK_WAIT_MULTIPLE FALSE           /* Service call enabler */
+#define NUSE_TASK_STACK_HIGH_WATER FALSE        /* Service call enabler */
+#define NUSE_TASK_RUNTIME       FALSE           /* Service call enabler */
+#define NUSE_TASK_LOAD          FALSE           /* Service call enabler */
+#define NUSE_TASK_RUNTIME_RESET FALSE           /* Service call enabler */
 
 #define NUSE_INITIAL_TASK_STATE_SUPPORT FALSE   /* Enables support for tasks starting as suspended */
 
 /*** Partition pools ***/
 
 #define NUSE_PARTITION_POOL_NUMBER      0       /* Number of partition pools in the system - 0-16 */
+#define NUSE_PARTITION_ALIGNMENT        0       /* Partition alignment in bytes - 0 [status byte before each partition] or a power of 2 */
+#define NUSE_PARTITION_COUNT_WIDTH      8       /* Partition count size in bits - 8 [up to 254 partitions per pool] or 16 */
 
 #define NUSE_PARTITION_ALLOCATE         FALSE   /* Service call enabler */
+#define NUSE_PARTITION_ALLOCATE_SIZE    FALSE   /* Service call enabler */
 #define NUSE_PARTITION_DEALLOCATE       FALSE   /* Service call enabler */
+#define NUSE_PARTITION_REFERENCE        FALSE   /* Service call enabler */
+#define NUSE_PARTITION_SEND             FALSE   /* Service call enabler */
 #define NUSE_PARTITION_POOL_INFORMATION FALSE   /* Service call enabler */
+#define NUSE_PARTITION_POOL_STATISTICS  FALSE   /* Service call enabler */
 #define NUSE_PARTITION_POOL_COUNT       FALSE   /* Service call enabler */
 
+/*** Memory pools ***/
+
+#define NUSE_MEMORY_POOL_NUMBER         0       /* Number of memory pools in the system - 0-16 */
+
+#define NUSE_MEMORY_ALLOCATE            FALSE   /* Service call enabler */
+#define NUSE_MEMORY_DEALLOCATE          FALSE   /* Service call enabler */
+#define NUSE_MEMORY_POOL_INFORMATION    FALSE   /* Service call enabler */
+#define NUSE_MEMORY_POOL_COUNT          FALSE   /* Service call enabler */
+
 /*** Mailboxes ***/
 
 #define NUSE_MAILBOX_NUMBER         1           /* Number of mailboxes in the system - 0-16 */
 
 #define NUSE_MAILBOX_SEND           TRUE        /* Service call enabler */
 #define NUSE_MAILBOX_RECEIVE        TRUE        /* Service call enabler */
+#define NUSE_MAILBOX_OVERWRITE      TRUE        /* Service call enabler */
 #define NUSE_MAILBOX_RESET          FALSE       /* Service call enabler */
 #define NUSE_MAILBOX_INFORMATION    FALSE       /* Service call enabler */
 #define NUSE_MAILBOX_COUNT          FALSE       /* Service call enabler */
@@ -61,6 +82,7 @@
 #define NUSE_QUEUE_SEND         TRUE            /* Service call enabler */
 #define NUSE_QUEUE_RECEIVE      TRUE            /* Service call enabler */
 #define NUSE_QUEUE_JAM          FALSE           /* Service call enabler */
+#define NUSE_QUEUE_BROADCAST    FALSE           /* Service call enabler */
 #define NUSE_QUEUE_RESET        FALSE           /* Service call enabler */
 #define NUSE_QUEUE_INFORMATION  FALSE           /* Service call enabler */
 #define NUSE_QUEUE_COUNT        FALSE           /* Service call enabler */
@@ -72,13 +94,33 @@
 #define NUSE_PIPE_SEND          FALSE           /* Service call enabler */
 #define NUSE_PIPE_RECEIVE       FALSE           /* Service call enabler */
 #define NUSE_PIPE_JAM           FALSE           /* Service call enabler */
+#define NUSE_PIPE_BROADCAST     FALSE           /* Service call enabler */
 #define NUSE_PIPE_RESET         FALSE           /* Service call enabler */
 #define NUSE_PIPE_INFORMATION   FALSE           /* Service call enabler */
 #define NUSE_PIPE_COUNT         FALSE           /* Service call enabler */
 
+/*** Channels ***/
+
+#define NUSE_CHANNEL_NUMBER     0               /* Number of channels in the system - 0-16 */
+
+#define NUSE_CHANNEL_PUT        FALSE           /* Service call enabler */
+#define NUSE_CHANNEL_GET        FALSE           /* Service call enabler */
+#define NUSE_CHANNEL_INFORMATION FALSE          /* Service call enabler */
+#define NUSE_CHANNEL_COUNT      FALSE           /* Service call enabler */
+
+/*** State Boards ***/
+
+#define NUSE_BOARD_NUMBER       0               /* Number of state boards in the system - 0-16 */
+
+#define NUSE_BOARD_WRITE        FALSE           /* Service call enabler */
+#define NUSE_BOARD_READ         FALSE           /* Service call enabler */
+#define NUSE_BOARD_INFORMATION  FALSE           /* Service call enabler */
+#define NUSE_BOARD_COUNT        FALSE           /* Service call enabler */
+
 /*** Semaphores ***/
 
 #define NUSE_SEMAPHORE_NUMBER       0           /* Number of semaphores in the system - 0-16 */
+#define NUSE_SEMAPHORE_WIDTH        8           /* Semaphore counter size in bits - 8, 16 or 32 */
 
 #define NUSE_SEMAPHORE_OBTAIN       FALSE       /* Service call enabler */
 #define NUSE_SEMAPHORE_RELEASE      FALSE       /* Service call enabler */
@@ -86,9 +128,16 @@
 #define NUSE_SEMAPHORE_INFORMATION  FALSE       /* Service call enabler */
 #define NUSE_SEMAPHORE_COUNT        FALSE       /* Service call enabler */
 
+#define NUSE_BINARY_SEMAPHORE_NUMBER    0       /* Number of binary semaphores in the system - 0-16 */
+
+#define NUSE_BINARY_SEMAPHORE_OBTAIN    FALSE   /* Service call enabler */
+#define NUSE_BINARY_SEMAPHORE_RELEASE   FALSE   /* Service call enabler */
+#define NUSE_BINARY_SEMAPHORE_COUNT     FALSE   /* Service call enabler */
+
 /*** Event groups ***/
 
 #define NUSE_EVENT_GROUP_NUMBER         0       /* Number of event groups in the system - 0-16 */
+#define NUSE_EVENT_GROUP_WIDTH          8       /* Number of flags in each event group - 8, 16 or 32 */
 
 #define NUSE_EVENT_GROUP_SET            FALSE   /* Service call enabler */
 #define NUSE_EVENT_GROUP_RETRIEVE       FALSE   /* Service call enabler */
@@ -101,6 +150,7 @@
 
 #define NUSE_SIGNALS_SEND       FALSE           /* Service call enabler */
 #define NUSE_SIGNALS_RECEIVE    FALSE           /* Service call enabler */
+#define NUSE_SIGNALS_WAIT       FALSE           /* Service call enabler */
 
 /*** Timers ***/
 
@@ -138,9 +188,53 @@
 
 #define NUSE_SCHEDULE_COUNT_SUPPORT FALSE       /* Enables support for schedule counting of each task */
 
+#define NUSE_RUNTIME_SUPPORT        FALSE       /* Enables measurement of the run time of each task */
+#define NUSE_CYCLE_COUNTER()        0           /* Free running U32 time source - e.g. a hardware cycle counter */
+
+#define NUSE_STACK_PAINTING         FALSE       /* Enables measurement of task stack usage */
+#define NUSE_STACK_CHECK_SWITCH     FALSE       /* Enables a stack overflow check at each context switch */
+
 #define NUSE_SUSPEND_ENABLE         FALSE       /* Enables support for task suspend */
 #define NUSE_BLOCKING_ENABLE        FALSE       /* Enables blocking API calls */
 
+/*** Trace ***/
+
+#define NUSE_TRACE_SUPPORT          FALSE       /* Enables recording of kernel events in the trace buffer */
+#define NUSE_TRACE_API              FALSE       /* Enables recording of API service call entry and exit */
+#define NUSE_TRACE_SIZE             0           /* Number of records in the trace buffer - a power of 2 */
+#define NUSE_TRACE_TIMESTAMP()      0           /* Free running time source for trace records - e.g. a hardware timer */
+
+/*** Statistics ***/
+
+#define NUSE_WAIT_STATISTICS_SUPPORT FALSE      /* Enables blocking and wait time statistics for each object */
+#define NUSE_WAIT_STATISTICS        FALSE       /* Service call enabler */
+#define NUSE_WAIT_STATISTICS_RESET  FALSE       /* Service call enabler */
+
+#define NUSE_CS_PROFILE_SUPPORT     FALSE       /* Enables measurement of critical section duration */
+#define NUSE_CS_PROFILE_SITES       0           /* Number of critical section exit points recorded */
+#define NUSE_CS_PROFILE_SITE        FALSE       /* Service call enabler */
+#define NUSE_CS_PROFILE_HISTOGRAM   FALSE       /* Service call enabler */
+#define NUSE_CS_PROFILE_RESET       FALSE       /* Service call enabler */
+
+#define NUSE_LATENCY_SUPPORT        FALSE       /* Enables interrupt and context switch latency histograms */
+#define NUSE_LATENCY_HISTOGRAM      FALSE       /* Service call enabler */
+#define NUSE_LATENCY_PERCENTILE     FALSE       /* Service call enabler */
+#define NUSE_LATENCY_RESET          FALSE       /* Service call enabler */
+
+/*** Deadlock detection ***/
+
+#define NUSE_DEADLOCK_DETECTION_SUPPORT FALSE   /* Enables wait-for graph deadlock detection */
+#define NUSE_DEADLOCK_PARTITIONS    FALSE       /* Includes partition pools in deadlock detection */
+#define NUSE_DEADLOCK_INFORMATION   FALSE       /* Service call enabler */
+
+/*** Task watchdog ***/
+
+#define NUSE_WATCHDOG_SUPPORT       FALSE       /* Enables the task liveness watchdog */
+#define NUSE_WATCHDOG_HANDLER(task) NUSE_Watchdog_Reset(task)  /* Called from the clock ISR when a task misses a check-in */
+#define NUSE_WATCHDOG_START         FALSE       /* Service call enabler */
+#define NUSE_WATCHDOG_CHECK_IN      FALSE       /* Service call enabler */
+#define NUSE_WATCHDOG_STOP          FALSE       /* Service call enabler */
+
 #define NUSE_INCLUDE_EVERYTHING     FALSE       /* enable all facilities and APIs - for debug/porting only */
 
 #endif  /* ! _NUSE_CONFIG_H_ */
@@ -0,0 +1,805 @@
+/*** Host simulation harness ***/
+
+/************************************************************************
+*
+*   This is a host program [not part of the Nucleus SE kernel] which runs
+*   a Nucleus SE application - kernel, nuse_config.c and task code - on a
+*   virtual clock, so that its worst case response times may be found
+*   offline
+*
+*   It replaces nuse_main.c, nuse_context.c and nuse_vector.c, and the
+*   ColdFire nuse_types.h is replaced by the version in this directory:
+*   tasks run on host stacks and are switched with ucontext; critical
+*   sections mask simulated interrupts
+*
+*   Virtual time only advances when task code calls NUSE_Sim_Work(), to
+*   model its execution time, and when the kernel leaves a critical
+*   section [the -k cost]; a task which loops without doing either
+*   will stop the simulation
+*   The clock tick [source 0] and the managed ISRs registered by
+*   NUSE_Sim_Setup() are injected on the virtual clock; the arrival times
+*   of the other sources are drawn from a seeded random sequence, or
+*   replayed from a recorded pattern, so every run is repeatable
+*
+*       nuse_sim [-s seed] [-d duration] [-t tick] [-k cs_cost] [-i isr_cost]
+*                [-r replay_file] [-w record_file]
+*
+*   All times are in virtual cycles
+*   A replay or record file holds one interrupt per line - "time source" -
+*   in time order; the clock tick is not recorded, as it is periodic
+*
+*   For each task, a job is released when the task becomes ready and
+*   completes when it next suspends [or suspends for the reason given to
+*   NUSE_Sim_Deadline()]; its response time is measured against its
+*   deadline. If the job was released by an ISR, it is measured from the
+*   arrival of the interrupt
+*   Blocking time is the part of a job's response time for which it was
+*   held up by lower priority code - interrupts masked when its interrupt
+*   arrived and, with the priority scheduler, lower priority tasks running
+*
+************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ucontext.h>
+
+#include "nuse_config.h"
+#include "nuse_codes.h"
+#include "nuse_types.h"
+#include "nuse_data.h"
+#include "nuse_prototypes.h"
+#include "nuse_sim.h"
+
+#if NUSE_SCHEDULER_TYPE == NUSE_RUN_TO_COMPLETION_SCHEDULER
+    #error The simulation needs a scheduler which switches task context
+#endif
+
+typedef unsigned long long SIM_TIME;
+
+#define SIM_NEVER       (~(SIM_TIME)0)
+#define SIM_STACK_SIZE  (64 * 1024)             /* host stack for each task */
+
+/* options */
+
+static SIM_TIME Sim_End = 100000000;
+static U32 Sim_Tick_Period = 10000;
+static U32 Sim_CS_Cost = 50;
+static U32 Sim_ISR_Cost = 200;
+static U32 Sim_Seed = 1;
+static FILE *Sim_Record;
+
+/* processor */
+
+static SIM_TIME Sim_Now;
+static int Sim_Masked;
+static int Sim_In_ISR;                          /* ISR running - jobs released now were released by it */
+static SIM_TIME Sim_ISR_Arrival;
+static SIM_TIME Sim_ISR_Delay;                  /* from arrival to the ISR starting */
+
+static ucontext_t Sim_Context[NUSE_TASK_NUMBER];
+static int Sim_Task_Masked[NUSE_TASK_NUMBER];
+static char Sim_Stack[NUSE_TASK_NUMBER][SIM_STACK_SIZE];
+static ucontext_t Sim_Return_Context;
+static char Sim_Return_Stack[SIM_STACK_SIZE];
+
+/* interrupt sources */
+
+static PF0 Sim_ISR[NUSE_SIM_SOURCES];
+static U32 Sim_Min_Interval[NUSE_SIM_SOURCES];
+static U32 Sim_Max_Interval[NUSE_SIM_SOURCES];
+static SIM_TIME Sim_Arrival[NUSE_SIM_SOURCES];  /* next arrival */
+static int Sim_Pending[NUSE_SIM_SOURCES];
+static SIM_TIME Sim_Pending_Since[NUSE_SIM_SOURCES];
+static unsigned long Sim_Arrivals[NUSE_SIM_SOURCES];
+static unsigned long Sim_Overruns[NUSE_SIM_SOURCES];  /* arrived while still pending */
+static SIM_TIME Sim_Worst_Delay[NUSE_SIM_SOURCES];
+
+static SIM_TIME *Replay_Time;                   /* replayed interrupts, in time order */
+static U8 *Replay_Source;
+static unsigned long Replay_Count;
+static unsigned long Replay_Index[NUSE_SIM_SOURCES];
+static int Replaying;
+
+/* tasks */
+
+static U32 Sim_Deadline[NUSE_TASK_NUMBER];
+static U8 Sim_Job_End[NUSE_TASK_NUMBER];
+static int Sim_Was_Ready[NUSE_TASK_NUMBER];
+static int Sim_Job_Active[NUSE_TASK_NUMBER];
+static SIM_TIME Sim_Release[NUSE_TASK_NUMBER];
+static SIM_TIME Sim_Blocking[NUSE_TASK_NUMBER];
+static unsigned long Sim_Jobs[NUSE_TASK_NUMBER];
+static unsigned long Sim_Misses[NUSE_TASK_NUMBER];
+static SIM_TIME Sim_Total_Response[NUSE_TASK_NUMBER];
+static SIM_TIME Sim_Worst_Response[NUSE_TASK_NUMBER];
+static SIM_TIME Sim_Worst_Blocking[NUSE_TASK_NUMBER];
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       Sim_Random()
+*
+*   DESCRIPTION
+*
+*       Returns the next number in the seeded pseudo-random sequence
+*       [xorshift] - the same seed always gives the same run
+*
+*************************************************************************/
+
+static U32 Sim_Random(void)
+{
+    Sim_Seed ^= Sim_Seed << 13;
+    Sim_Seed ^= Sim_Seed >> 17;
+    Sim_Seed ^= Sim_Seed << 5;
+    return Sim_Seed;
+}
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       Sim_Report()
+*
+*   DESCRIPTION
+*
+*       Writes the task response times and interrupt statistics
+*       and ends the simulation
+*
+*************************************************************************/
+
+static void Sim_Report(const char *reason)
+{
+    NUSE_TASK task;
+    int source;
+
+    printf("%s at %llu cycles\n\n", reason, Sim_Now);
+
+    printf("task      jobs  mean_resp  worst_resp  worst_block   deadline  misses\n");
+    for (task=0; task<NUSE_TASK_NUMBER; task++)
+    {
+        printf("%4u  %8lu  %9llu  %10llu  %11llu  %9lu  %6lu\n", task, Sim_Jobs[task],
+               Sim_Jobs[task] ? Sim_Total_Response[task] / Sim_Jobs[task] : 0ULL,
+               Sim_Worst_Response[task], Sim_Worst_Blocking[task],
+               (unsigned long)Sim_Deadline[task], Sim_Misses[task]);
+    }
+
+    printf("\nsource  arrivals  overruns  worst_delay\n");
+    for (source=0; source<NUSE_SIM_SOURCES; source++)
+    {
+        if (Sim_ISR[source] != NULL)
+        {
+            printf("%6d  %8lu  %8lu  %11llu\n", source, Sim_Arrivals[source],
+                   Sim_Overruns[source], Sim_Worst_Delay[source]);
+        }
+    }
+
+    if (Sim_Record != NULL)
+    {
+        fclose(Sim_Record);
+    }
+    exit(0);
+}
+
+static void Sim_Fail(const char *reason)
+{
+    printf("nuse_sim: %s\n", reason);
+    Sim_Report("stopped");
+}
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       Sim_Schedule()
+*
+*   DESCRIPTION
+*
+*       Sets the time of the next arrival of an interrupt source - from the
+*       replay file, or a random interval after the previous arrival
+*       The clock tick is always periodic
+*
+*************************************************************************/
+
+static void Sim_Schedule(int source)
+{
+    U32 range;
+
+    if (Replaying && (source != 0))
+    {
+        while ((Replay_Index[source] < Replay_Count) && (Replay_Source[Replay_Index[source]] != source))
+        {
+            Replay_Index[source]++;
+        }
+        if (Replay_Index[source] < Replay_Count)
+        {
+            Sim_Arrival[source] = Replay_Time[Replay_Index[source]++];
+        }
+        else
+        {
+            Sim_Arrival[source] = SIM_NEVER;
+        }
+        return;
+    }
+
+    if ((Sim_ISR[source] == NULL) || (Sim_Max_Interval[source] == 0))
+    {
+        Sim_Arrival[source] = SIM_NEVER;
+        return;
+    }
+
+    range = Sim_Max_Interval[source] - Sim_Min_Interval[source];
+    Sim_Arrival[source] += Sim_Min_Interval[source];
+    if (range != 0)
+    {
+        Sim_Arrival[source] += Sim_Random() % (range + 1);
+    }
+}
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       Sim_Observe()
+*
+*   DESCRIPTION
+*
+*       Looks for tasks which have become ready [job released] or have
+*       suspended [job complete] since the last call
+*       Called whenever the kernel may have changed a task's status
+*
+*************************************************************************/
+
+static void Sim_Observe(void)
+{
+    NUSE_TASK task;
+    U8 status;
+    SIM_TIME response;
+
+    for (task=0; task<NUSE_TASK_NUMBER; task++)
+    {
+        #if NUSE_SUSPEND_ENABLE
+            status = NUSE_Task_Status[task];
+        #else
+            status = NUSE_READY;
+        #endif
+
+        if ((status == NUSE_READY) && !Sim_Was_Ready[task] && !Sim_Job_Active[task])
+        {                                                   /* released */
+            Sim_Job_Active[task] = TRUE;
+            if (Sim_In_ISR)
+            {
+                Sim_Release[task] = Sim_ISR_Arrival;
+                Sim_Blocking[task] = Sim_ISR_Delay;
+            }
+            else
+            {
+                Sim_Release[task] = Sim_Now;
+                Sim_Blocking[task] = 0;
+            }
+        }
+        else if ((status != NUSE_READY) && Sim_Was_Ready[task] && Sim_Job_Active[task] &&
+                 ((Sim_Job_End[task] == NUSE_SIM_ANY_SUSPEND) || (LONIB(status) == Sim_Job_End[task])))
+        {                                                   /* complete */
+            Sim_Job_Active[task] = FALSE;
+            response = Sim_Now - Sim_Release[task];
+            Sim_Jobs[task]++;
+            Sim_Total_Response[task] += response;
+            if (response > Sim_Worst_Response[task])
+            {
+                Sim_Worst_Response[task] = response;
+            }
+            if (Sim_Blocking[task] > Sim_Worst_Blocking[task])
+            {
+                Sim_Worst_Blocking[task] = Sim_Blocking[task];
+            }
+            if ((Sim_Deadline[task] != 0) && (response > Sim_Deadline[task]))
+            {
+                Sim_Misses[task]++;
+            }
+        }
+
+        Sim_Was_Ready[task] = (status == NUSE_READY);
+    }
+}
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       Sim_Elapse()
+*       Sim_Pass()
+*
+*   DESCRIPTION
+*
+*       Sim_Elapse() advances the virtual clock, charging the time as blocking
+*       to any higher priority task with a job in progress
+*       Sim_Pass() also latches the interrupts which arrive during that time,
+*       without running them
+*
+*************************************************************************/
+
+static void Sim_Elapse(SIM_TIME cycles)
+{
+    #if NUSE_SCHEDULER_TYPE == NUSE_PRIORITY_SCHEDULER
+        NUSE_TASK task;
+
+        if (!Sim_In_ISR)
+        {
+            for (task=0; task<NUSE_Task_Active; task++)
+            {
+                if (Sim_Job_Active[task])
+                {
+                    Sim_Blocking[task] += cycles;
+                }
+            }
+        }
+    #endif
+
+    Sim_Now += cycles;
+}
+
+static int Sim_Next_Source(void)
+{
+    int source, next = 0;
+
+    for (source=1; source<NUSE_SIM_SOURCES; source++)
+    {
+        if (Sim_Arrival[source] < Sim_Arrival[next])
+        {
+            next = source;
+        }
+    }
+    return next;
+}
+
+static void Sim_Arrive(int source)
+{
+    Sim_Elapse(Sim_Arrival[source] - Sim_Now);
+
+    Sim_Arrivals[source]++;
+    if (Sim_Pending[source])
+    {
+        Sim_Overruns[source]++;
+    }
+    else
+    {
+        Sim_Pending[source] = TRUE;
+        Sim_Pending_Since[source] = Sim_Now;
+    }
+
+    if ((Sim_Record != NULL) && (source != 0))
+    {
+        fprintf(Sim_Record, "%llu %d\n", Sim_Now, source);
+    }
+
+    Sim_Schedule(source);
+}
+
+static void Sim_Pass(SIM_TIME cycles)
+{
+    SIM_TIME until;
+    int source;
+
+    until = Sim_Now + cycles;
+    for (source=Sim_Next_Source(); Sim_Arrival[source]<=until; source=Sim_Next_Source())
+    {
+        Sim_Arrive(source);
+    }
+    Sim_Elapse(until - Sim_Now);
+}
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       Sim_Deliver()
+*
+*   DESCRIPTION
+*
+*       Runs the pending ISRs, lowest source number first, if interrupts
+*       are not masked
+*       A managed ISR may switch to another task on exit; this task then
+*       continues from here when it is next scheduled
+*
+*************************************************************************/
+
+static void Sim_Deliver(void)
+{
+    int source;
+
+    while (!Sim_Masked && (NUSE_Task_State == NUSE_TASK_CONTEXT))
+    {
+        for (source=0; source<NUSE_SIM_SOURCES; source++)
+        {
+            if (Sim_Pending[source])
+            {
+                break;
+            }
+        }
+        if (source == NUSE_SIM_SOURCES)
+        {
+            return;
+        }
+
+        Sim_Pending[source] = FALSE;
+        Sim_ISR_Arrival = Sim_Pending_Since[source];
+        Sim_ISR_Delay = Sim_Now - Sim_ISR_Arrival;
+        if (Sim_ISR_Delay > Sim_Worst_Delay[source])
+        {
+            Sim_Worst_Delay[source] = Sim_ISR_Delay;
+        }
+
+        Sim_Masked = TRUE;
+        Sim_In_ISR = TRUE;
+        Sim_Pass(Sim_ISR_Cost);
+        Sim_ISR[source]();
+        Sim_Observe();                              /* native ISRs do not swap */
+        Sim_In_ISR = FALSE;
+        Sim_Masked = FALSE;
+    }
+}
+
+static void Sim_Check_End(void)
+{
+    if (Sim_Now >= Sim_End)
+    {
+        Sim_Report("finished");
+    }
+}
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       Sim_Prepare()
+*       Sim_Task_Return()
+*
+*   DESCRIPTION
+*
+*       Sim_Prepare() creates the host context for a task, to start at its
+*       entry function; called when the kernel has initialized [or reset]
+*       the task, which it shows by setting the saved SP
+*       Sim_Task_Return() is reached if a task function returns
+*
+*************************************************************************/
+
+static void Sim_Prepare(NUSE_TASK task)
+{
+    getcontext(&Sim_Context[task]);
+    Sim_Context[task].uc_stack.ss_sp = Sim_Stack[task];
+    Sim_Context[task].uc_stack.ss_size = SIM_STACK_SIZE;
+    Sim_Context[task].uc_link = &Sim_Return_Context;
+    makecontext(&Sim_Context[task], (void (*)(void))NUSE_Task_Start_Address[task], 0);
+
+    Sim_Task_Masked[task] = FALSE;
+    NUSE_Task_Context[task][17] = NULL;             /* SP - marks the host context as current */
+}
+
+static void Sim_Task_Return(void)
+{
+    Sim_Fail("a task function returned");
+}
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Context_Load()
+*       NUSE_Sim_Swap()
+*
+*   DESCRIPTION
+*
+*       Simulated context switch - the task in NUSE_Task_Next is run
+*       NUSE_Context_Load() starts the first task, from the scheduler
+*       NUSE_Sim_Swap() replaces the trap used by NUSE_Reschedule() and the
+*       context load at the end of a managed ISR; the interrupt mask is saved
+*       with the outgoing task, as the status register would be
+*
+*************************************************************************/
+
+void NUSE_Context_Load(void)
+{
+    NUSE_Task_Active = NUSE_Task_Next;
+    if (NUSE_Task_Context[NUSE_Task_Active][17] != NULL)
+    {
+        Sim_Prepare(NUSE_Task_Active);
+    }
+
+    Sim_Observe();
+    Sim_Masked = FALSE;
+    setcontext(&Sim_Context[NUSE_Task_Active]);
+}
+
+void NUSE_Sim_Swap(void)
+{
+    NUSE_TASK from, to;
+    int prepared = FALSE;
+
+    Sim_Observe();
+    Sim_In_ISR = FALSE;
+
+    from = NUSE_Task_Active;
+    to = NUSE_Task_Next;
+    if (to >= NUSE_TASK_NUMBER)
+    {
+        Sim_Fail("no task is ready to run - an idle task is required");
+    }
+
+    if (NUSE_Task_Context[to][17] != NULL)
+    {
+        Sim_Prepare(to);
+        prepared = TRUE;
+    }
+
+    NUSE_Task_Active = to;
+    if (to == from)
+    {
+        if (prepared)
+        {
+            setcontext(&Sim_Context[to]);           /* task has reset itself */
+        }
+        return;
+    }
+
+    Sim_Task_Masked[from] = Sim_Masked;
+    Sim_Masked = Sim_Task_Masked[to];
+    swapcontext(&Sim_Context[from], &Sim_Context[to]);
+}
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Sim_Mask()
+*       NUSE_Sim_Unmask()
+*
+*   DESCRIPTION
+*
+*       Critical section entry and exit - interrupts which arrive while
+*       masked are run on exit; each critical section costs the -k time
+*
+*************************************************************************/
+
+void NUSE_Sim_Mask(void)
+{
+    Sim_Masked = TRUE;
+}
+
+void NUSE_Sim_Unmask(void)
+{
+    Sim_Pass(Sim_CS_Cost);
+    Sim_Observe();
+    Sim_Masked = FALSE;
+    Sim_Deliver();
+    Sim_Check_End();
+}
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Sim_Work()
+*
+*   DESCRIPTION
+*
+*       Models the execution time of task code - virtual time advances by the
+*       given number of cycles of this task's execution, during which it may
+*       be interrupted and preempted
+*
+*   INPUTS
+*
+*       U32 cycles              execution time
+*
+*************************************************************************/
+
+void NUSE_Sim_Work(U32 cycles)
+{
+    SIM_TIME remaining = cycles;
+    int source;
+
+    Sim_Deliver();
+    while (remaining != 0)
+    {
+        source = Sim_Next_Source();
+        if (Sim_Arrival[source] > Sim_Now + remaining)
+        {
+            Sim_Elapse(remaining);
+            break;
+        }
+
+        remaining -= Sim_Arrival[source] - Sim_Now;
+        Sim_Arrive(source);
+        Sim_Deliver();
+        Sim_Check_End();
+    }
+    Sim_Check_End();
+}
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Sim_Interrupt()
+*       NUSE_Sim_Deadline()
+*       NUSE_Sim_Clock()
+*
+*   DESCRIPTION
+*
+*       NUSE_Sim_Interrupt() registers an ISR as an interrupt source [1 to
+*       NUSE_SIM_SOURCES-1], arriving at random intervals in the given range
+*       [ignored when replaying]
+*       NUSE_Sim_Deadline() sets a task's deadline [0 for none] and the
+*       suspension which ends its job - a suspend code such as NUSE_SLEEP_SUSPEND,
+*       or NUSE_SIM_ANY_SUSPEND
+*       NUSE_Sim_Clock() returns the virtual time - NUSE_CYCLE_COUNTER() and
+*       NUSE_TRACE_TIMESTAMP() may be mapped to it in nuse_config.h
+*
+*************************************************************************/
+
+void NUSE_Sim_Interrupt(U8 source, PF0 isr, U32 min_interval, U32 max_interval)
+{
+    if ((source == 0) || (source >= NUSE_SIM_SOURCES) || (min_interval > max_interval))
+    {
+        fprintf(stderr, "nuse_sim: invalid interrupt source %u\n", source);
+        exit(1);
+    }
+
+    Sim_ISR[source] = isr;
+    Sim_Min_Interval[source] = min_interval;
+    Sim_Max_Interval[source] = max_interval;
+}
+
+void NUSE_Sim_Deadline(NUSE_TASK task, U32 deadline, U8 job_end)
+{
+    if (task >= NUSE_TASK_NUMBER)
+    {
+        fprintf(stderr, "nuse_sim: invalid task %u\n", task);
+        exit(1);
+    }
+
+    Sim_Deadline[task] = deadline;
+    Sim_Job_End[task] = job_end;
+}
+
+U32 NUSE_Sim_Clock(void)
+{
+    return (U32)Sim_Now;
+}
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       Replay_Read()
+*
+*   DESCRIPTION
+*
+*       Reads a recorded interrupt pattern - one "time source" pair per line,
+*       in time order; blank lines and lines starting with # are ignored
+*
+*************************************************************************/
+
+static void Replay_Read(const char *name)
+{
+    FILE *file;
+    char line[100];
+    unsigned long long time, previous = 0;
+    unsigned source;
+    unsigned long size = 0;
+
+    file = fopen(name, "r");
+    if (file == NULL)
+    {
+        fprintf(stderr, "nuse_sim: cannot open %s\n", name);
+        exit(1);
+    }
+
+    while (fgets(line, sizeof(line), file) != NULL)
+    {
+        if ((line[0] == '#') || (sscanf(line, "%llu %u", &time, &source) != 2))
+        {
+            continue;
+        }
+
+        if ((source == 0) || (source >= NUSE_SIM_SOURCES) || (time < previous))
+        {
+            fprintf(stderr, "nuse_sim: invalid replay entry: %s", line);
+            exit(1);
+        }
+        previous = time;
+
+        if (Replay_Count == size)
+        {
+            size = size ? size * 2 : 1024;
+            Replay_Time = realloc(Replay_Time, size * sizeof(SIM_TIME));
+            Replay_Source = realloc(Replay_Source, size);
+            if ((Replay_Time == NULL) || (Replay_Source == NULL))
+            {
+                fprintf(stderr, "nuse_sim: out of memory\n");
+                exit(1);
+            }
+        }
+        Replay_Time[Replay_Count] = time;
+        Replay_Source[Replay_Count] = (U8)source;
+        Replay_Count++;
+    }
+
+    fclose(file);
+    Replaying = TRUE;
+}
+
+
+int main(int argc, char *argv[])
+{
+    int arg, source;
+
+    for (arg=1; arg<argc; arg++)
+    {
+        if ((argv[arg][0] != '-') || (argv[arg][1] == '\0') || (argv[arg][2] != '\0') || (arg + 1 == argc))
+        {
+            break;
+        }
+
+        switch (argv[arg++][1])
+        {
+            case 's': Sim_Seed = strtoul(argv[arg], NULL, 0); break;
+            case 'd': Sim_End = strtoull(argv[arg], NULL, 0); break;
+            case 't': Sim_Tick_Period = strtoul(argv[arg], NULL, 0); break;
+            case 'k': Sim_CS_Cost = strtoul(argv[arg], NULL, 0); break;
+            case 'i': Sim_ISR_Cost = strtoul(argv[arg], NULL, 0); break;
+            case 'r': Replay_Read(argv[arg]); break;
+            case 'w':
+                Sim_Record = fopen(argv[arg], "w");
+                if (Sim_Record == NULL)
+                {
+                    fprintf(stderr, "nuse_sim: cannot create %s\n", argv[arg]);
+                    return 1;
+                }
+                break;
+            default: arg = argc + 1; break;
+        }
+    }
+
+    if ((arg != argc) || (Sim_Seed == 0))
+    {
+        fprintf(stderr, "usage: nuse_sim [-s seed] [-d duration] [-t tick] [-k cs_cost] [-i isr_cost] [-r replay_file] [-w record_file]\n");
+        return 1;
+    }
+
+    printf("nuse_sim: seed %lu, duration %llu, tick %lu, cs_cost %lu, isr_cost %lu\n",
+           (unsigned long)Sim_Seed, Sim_End, (unsigned long)Sim_Tick_Period,
+           (unsigned long)Sim_CS_Cost, (unsigned long)Sim_ISR_Cost);
+
+    Sim_ISR[0] = NUSE_Real_Time_Clock_ISR;
+    Sim_Min_Interval[0] = Sim_Max_Interval[0] = Sim_Tick_Period;
+    NUSE_Sim_Setup();
+
+    for (source=0; source<NUSE_SIM_SOURCES; source++)
+    {
+        Sim_Schedule(source);
+    }
+
+    getcontext(&Sim_Return_Context);
+    Sim_Return_Context.uc_stack.ss_sp = Sim_Return_Stack;
+    Sim_Return_Context.uc_stack.ss_size = SIM_STACK_SIZE;
+    Sim_Return_Context.uc_link = NULL;
+    makecontext(&Sim_Return_Context, Sim_Task_Return, 0);
+
+    NUSE_Init();
+    NUSE_Scheduler();                               /* does not return */
+    return 0;
+}
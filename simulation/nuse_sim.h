@@ -0,0 +1,27 @@
+/*************************************************************************
+*
+*   This file contains the definitions and prototypes for the Nucleus SE
+*   host simulation [see nuse_sim.c], for use by the application's
+*   simulation set-up and by task code which models its execution time
+*
+*************************************************************************/
+
+/* Check to see if the file has been included already.  */
+#ifndef _NUSE_SIM_H_
+#define _NUSE_SIM_H_
+
+#define NUSE_SIM_SOURCES        8       /* Number of interrupt sources - 0 is the clock tick */
+#define NUSE_SIM_ANY_SUSPEND    (0)     /* job_end option - any suspension ends a job */
+
+/* supplied by the application - see nuse_sim_setup.c */
+
+void    NUSE_Sim_Setup(void);
+
+/* simulation API */
+
+void    NUSE_Sim_Interrupt(U8 source, PF0 isr, U32 min_interval, U32 max_interval);
+void    NUSE_Sim_Deadline(NUSE_TASK task, U32 deadline, U8 job_end);
+void    NUSE_Sim_Work(U32 cycles);
+U32     NUSE_Sim_Clock(void);
+
+#endif  /* ! _NUSE_SIM_H_ */
@@ -0,0 +1,24 @@
+#include "nuse.h"
+#include "nuse_sim.h"
+
+/*************************************************************************
+*
+*   This is the file in which the user configures the host simulation
+*   [see nuse_sim.c] for a Nucleus SE application
+*   The values here are for the priority scheduler simple demo
+*
+*************************************************************************/
+
+void NUSE_Sim_Setup(void)
+{
+    /* interrupt sources 1 to NUSE_SIM_SOURCES-1 ------ */
+    /* managed ISR and range of interval between arrivals [cycles] */
+    /* e.g. NUSE_Sim_Interrupt(1, Uart_ISR, 20000, 50000); */
+
+    /* task deadlines ------ */
+    /* deadline [cycles, 0 for none] and the suspension which ends a job */
+
+    NUSE_Sim_Deadline(0, 2000, NUSE_SIM_ANY_SUSPEND);
+    NUSE_Sim_Deadline(1, 5000, NUSE_SIGNAL_SUSPEND);
+    NUSE_Sim_Deadline(2, 0, NUSE_SIM_ANY_SUSPEND);
+}
@@ -0,0 +1,174 @@
+/*************************************************************************
+*
+*   This file contains the definition of data types used by Nucleus SE
+*   This version is for the host simulation [see nuse_sim.c] and replaces
+*   the ColdFire version in src; the CPU-specific information is mapped
+*   onto the simulator:
+*       Critical section entry/exit macros mask simulated interrupts
+*       Context saving data is unused; tasks run on host stacks
+*       Native interrupt support macros are unchanged
+*       Managed interrupt support macros swap context on exit in the simulator
+*
+*************************************************************************/
+
+/* Check to see if the file has been included already.  */
+#ifndef _NUSE_TYPES_H_
+#define _NUSE_TYPES_H_
+
+#include "nuse_config.h"
+
+
+/* Data types used by Nucleus SE - these may need to be adjusted for different compilers/CPUs */
+
+typedef unsigned char U8;       /* unsigned 8 bit integer */
+typedef signed char S8;         /* signed 8 bit integer */
+typedef unsigned short U16;     /* unsigned 16 bit integer */
+typedef unsigned int U32;       /* unsigned 32 bit integer - also on 64 bit hosts */
+typedef void * ADDR;            /* pointer/address */
+
+typedef S8 STATUS;              /* service call status return value */
+typedef U8 OPTION;              /* service call option parameter value */
+
+typedef U8 NUSE_TASK;           /* kernel object index data types */
+typedef U8 NUSE_PARTITION_POOL;
+typedef U8 NUSE_MEMORY_POOL;
+typedef U8 NUSE_MAILBOX;
+typedef U8 NUSE_QUEUE;
+typedef U8 NUSE_PIPE;
+typedef U8 NUSE_CHANNEL;
+typedef U8 NUSE_BOARD;
+typedef U8 NUSE_SEMAPHORE;
+typedef U8 NUSE_BINARY_SEMAPHORE;
+typedef U8 NUSE_EVENT_GROUP;
+typedef U8 NUSE_TIMER;
+
+#if NUSE_EVENT_GROUP_WIDTH == 32    /* event flags data type follows the configured group width */
+    typedef U32 NUSE_EVENT_FLAGS;
+#elif NUSE_EVENT_GROUP_WIDTH == 16
+    typedef U16 NUSE_EVENT_FLAGS;
+#else
+    typedef U8 NUSE_EVENT_FLAGS;
+#endif
+
+#if NUSE_SEMAPHORE_WIDTH == 32      /* semaphore counter data type follows the configured width */
+    typedef U32 NUSE_SEMAPHORE_COUNTER;
+#elif NUSE_SEMAPHORE_WIDTH == 16
+    typedef U16 NUSE_SEMAPHORE_COUNTER;
+#else
+    typedef U8 NUSE_SEMAPHORE_COUNTER;
+#endif
+
+#define NUSE_SEMAPHORE_MAXIMUM ((NUSE_SEMAPHORE_COUNTER)~0)
+
+#if NUSE_PARTITION_COUNT_WIDTH == 16    /* partition count data type follows the configured width */
+    typedef U16 NUSE_PARTITION_COUNT;
+#else
+    typedef U8 NUSE_PARTITION_COUNT;
+#endif
+
+#define TRUE (1)
+#define FALSE (0)
+
+#ifndef NULL                    /* may already be defined by the host headers */
+    #define NULL (0)
+#endif
+
+#define LONIB(x) ((x) & 0xf)
+#define HINIB(x) (((x) >> 4) & 0xf)
+
+#define ROM
+#define RAM
+
+#define INTERRUPT
+
+typedef void (*PF0)(void);
+typedef void (*PF1)(U8);
+typedef void (*PF2)(U8, ADDR);
+
+/*** CPU specfics - simulated ***/
+
+void NUSE_Sim_Mask(void);               /* see nuse_sim.c */
+void NUSE_Sim_Unmask(void);
+void NUSE_Sim_Swap(void);
+
+/* Critical section delimiters - if profiling is configured, the time for which */
+/* interrupts are masked is recorded against the exit point */
+
+#if NUSE_CS_PROFILE_SUPPORT
+
+    #define NUSE_CS_Enter()                             \
+        if (NUSE_Task_State == NUSE_TASK_CONTEXT)       \
+        {                                               \
+            NUSE_Sim_Mask();                            \
+            NUSE_CS_Profile_Enter();                    \
+        }
+
+    #define NUSE_CS_Exit()                              \
+        if (NUSE_Task_State == NUSE_TASK_CONTEXT)       \
+        {                                               \
+            NUSE_CS_Profile_Exit(__FILE__, __LINE__);   \
+            NUSE_Sim_Unmask();                          \
+        }
+
+#else
+
+    #define NUSE_CS_Enter()                 \
+        if (NUSE_Task_State == NUSE_TASK_CONTEXT)   \
+            NUSE_Sim_Mask();
+
+    #define NUSE_CS_Exit()                  \
+        if (NUSE_Task_State == NUSE_TASK_CONTEXT)   \
+            NUSE_Sim_Unmask();
+
+#endif
+
+#define NUSE_REGISTERS          18
+#define NUSE_STATUS_REGISTER    ((ADDR)0x40002000)
+
+#define NUSE_CONTEXT_SWAP() \
+    NUSE_Sim_Swap();
+
+/* Interrupt Service Routine Support */
+
+#if NUSE_TRACE_SUPPORT
+    #define NUSE_TRACE_ISR(event) NUSE_Trace_ISR(event);
+#else
+    #define NUSE_TRACE_ISR(event)
+#endif
+
+#if NUSE_LATENCY_SUPPORT
+    #define NUSE_LATENCY_ISR() NUSE_Latency_ISR();
+#else
+    #define NUSE_LATENCY_ISR()
+#endif
+
+/* Native interrupts */
+
+#define NUSE_NISR_Enter() \
+static U8 NUSE_Old_Task_State; \
+NUSE_Old_Task_State = NUSE_Task_State; \
+NUSE_Task_State = NUSE_NISR_CONTEXT; \
+NUSE_TRACE_ISR(NUSE_TRACE_ISR_ENTRY)
+
+#define NUSE_NISR_Exit() \
+NUSE_TRACE_ISR(NUSE_TRACE_ISR_EXIT) \
+NUSE_Task_State = NUSE_Old_Task_State;
+
+/* Managed interrupts - the task in NUSE_Task_Next is run on exit, as by the */
+/* context load on the target */
+
+#define NUSE_MANAGED_ISR(isrname, isrcode) \
+void isrname () \
+{ \
+NUSE_Task_Saved_State = NUSE_Task_State; \
+NUSE_Task_State = NUSE_MISR_CONTEXT; \
+NUSE_LATENCY_ISR() \
+NUSE_TRACE_ISR(NUSE_TRACE_ISR_ENTRY) \
+isrcode(); \
+NUSE_TRACE_ISR(NUSE_TRACE_ISR_EXIT) \
+NUSE_Task_State = NUSE_Task_Saved_State; \
+NUSE_Sim_Swap(); \
+}
+
+#endif  /* ! _NUSE_TYPES_H_ */
+
@@ -14,6 +14,7 @@
 #include "nuse_prototypes.h"
 #include "nuse_codes.h"
 #include "nuse_binary.h"
+#include "nuse_trace.h"
 
 #endif  /* ! _NUSE_H_ */
 
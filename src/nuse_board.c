@@ -0,0 +1,284 @@
+/*** State board handling APIs ***/
+
+/************************************************************************
+*
+*   This file contains the definitions of functions concerned with the
+*   handling of state boards in Nucleus SE:
+*
+*   NUSE_Board_Write()
+*   NUSE_Board_Read()
+*   NUSE_Board_Information()
+*   NUSE_Board_Count()
+*
+*   A state board holds the latest value of a fixed size (type U8[]) record,
+*   such as a set of sensor readings, written by one producer and read by
+*   any number of tasks
+*   The data area holds two copies of the record; the producer always
+*   writes the copy which is not current and then publishes it by
+*   incrementing the sequence number, the low bit of which selects the
+*   current copy
+*   A reader copies out the current record and then checks that the
+*   sequence number has not changed; if it has, the producer may have
+*   started to overwrite that copy, so the read is retried
+*   Neither side masks interrupts and the producer never waits for readers
+*
+************************************************************************/
+
+#include "nuse_config.h"
+#include "nuse_codes.h"
+#include "nuse_types.h"
+#include "nuse_data.h"
+#include "nuse_prototypes.h"
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Board_Write()
+*
+*   DESCRIPTION
+*
+*       Writes a new (type U8[]) record to the state board - producer side
+*       The record is stored in the copy which is not current, before the sequence
+*       number is incremented to publish it
+*       Only one task or ISR may write to a given state board
+*       Never blocks, so may be called from any ISR
+*
+*   INPUTS
+*
+*       NUSE_BOARD board        index of state board to be used
+*       U8 *data                pointer to the record to be written
+*       U8 size                 record size; must correspond to the size configured for the board [in nuse_config.c]
+*
+*   RETURNS
+*
+*       NUSE_SUCCESS            record successfully written
+*       NUSE_INVALID_BOARD      specified state board index is invalid
+*       NUSE_INVALID_POINTER    data pointer [data] is NULL
+*       NUSE_INVALID_SIZE       record size parameter [size] did not correspond to the size configured for the board
+*
+*   OTHER OUTPUTS
+*
+*       (none)
+*
+*************************************************************************/
+
+#if NUSE_BOARD_WRITE || (NUSE_INCLUDE_EVERYTHING && (NUSE_BOARD_NUMBER != 0))
+
+    STATUS NUSE_Board_Write(NUSE_BOARD board, U8 *data, U8 size)
+    {
+        U8 i, recsize;
+        U16 sequence;
+        volatile U8 *copy;
+
+        #if NUSE_API_PARAMETER_CHECKING
+            if (board >= NUSE_BOARD_NUMBER)
+            {
+                return NUSE_INVALID_BOARD;
+            }
+
+            if (data == NULL)
+            {
+                return NUSE_INVALID_POINTER;
+            }
+
+            if (size != NUSE_Board_Size[board])
+            {
+                return NUSE_INVALID_SIZE;
+            }
+        #endif
+
+        recsize = NUSE_Board_Size[board];
+        sequence = NUSE_Board_Sequence[board] + 1;
+
+        copy = (volatile U8 *)NUSE_Board_Data[board];
+        if (sequence & 1)
+        {
+            copy += recsize;
+        }
+
+        for (i=0; i<recsize; i++)
+        {
+            *copy++ = *data++;
+        }
+        NUSE_Board_Sequence[board] = sequence;                  /* publish - must follow the data write */
+
+        return NUSE_SUCCESS;
+    }
+
+#endif
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Board_Read()
+*
+*   DESCRIPTION
+*
+*       Takes a consistent snapshot of the current (type U8[]) record on the state board
+*       Retries if the producer published a new record during the copy; readers never
+*       block and never hold up the producer
+*       The record is not consumed - every reader sees the latest value
+*
+*   INPUTS
+*
+*       NUSE_BOARD board        index of state board to be used
+*       U8 *data                pointer to storage for the record
+*       U8 size                 record size; must correspond to the size configured for the board [in nuse_config.c]
+*
+*   RETURNS
+*
+*       NUSE_SUCCESS            record successfully read
+*       NUSE_INVALID_BOARD      specified state board index is invalid
+*       NUSE_INVALID_POINTER    data pointer [data] is NULL
+*       NUSE_INVALID_SIZE       record size parameter [size] did not correspond to the size configured for the board
+*
+*   OTHER OUTPUTS
+*
+*       U8 *data                snapshot of the current record
+*
+*************************************************************************/
+
+#if NUSE_BOARD_READ || (NUSE_INCLUDE_EVERYTHING && (NUSE_BOARD_NUMBER != 0))
+
+    STATUS NUSE_Board_Read(NUSE_BOARD board, U8 *data, U8 size)
+    {
+        U8 i, recsize;
+        U16 sequence;
+        volatile U8 *copy;
+
+        #if NUSE_API_PARAMETER_CHECKING
+            if (board >= NUSE_BOARD_NUMBER)
+            {
+                return NUSE_INVALID_BOARD;
+            }
+
+            if (data == NULL)
+            {
+                return NUSE_INVALID_POINTER;
+            }
+
+            if (size != NUSE_Board_Size[board])
+            {
+                return NUSE_INVALID_SIZE;
+            }
+        #endif
+
+        recsize = NUSE_Board_Size[board];
+
+        do
+        {
+            sequence = NUSE_Board_Sequence[board];
+
+            copy = (volatile U8 *)NUSE_Board_Data[board];
+            if (sequence & 1)
+            {
+                copy += recsize;
+            }
+
+            for (i=0; i<recsize; i++)
+            {
+                data[i] = *copy++;
+            }
+        } while (sequence != NUSE_Board_Sequence[board]);      /* new record published during copy */
+
+        return NUSE_SUCCESS;
+    }
+
+#endif
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Board_Information()
+*
+*   DESCRIPTION
+*
+*       Returns a number of items of data about a state board
+*
+*   INPUTS
+*
+*       NUSE_BOARD board            index of state board about which information is required
+*       ADDR *start_address         pointer to storage for the start address of the board data area
+*       U8 *record_size             pointer to storage for the size of the record
+*       U16 *updates                pointer to storage for the number of records written
+*
+*   RETURNS
+*
+*       NUSE_SUCCESS                the state board status was successfully returned
+*       NUSE_INVALID_BOARD          the state board index was not valid
+*       NUSE_INVALID_POINTER        one or more of the pointer parameters was NULL
+*
+*   OTHER OUTPUTS
+*
+*       ADDR *start_address         start address of the board data area
+*       U8 *record_size             size of the record [in bytes]
+*       U16 *updates                number of records written since initialization [wraps around]
+*
+*************************************************************************/
+
+#if NUSE_BOARD_INFORMATION || (NUSE_INCLUDE_EVERYTHING && (NUSE_BOARD_NUMBER != 0))
+
+    STATUS NUSE_Board_Information(NUSE_BOARD board, ADDR *start_address, U8 *record_size, U16 *updates)
+    {
+        #if NUSE_API_PARAMETER_CHECKING
+            if (board >= NUSE_BOARD_NUMBER)
+            {
+                return NUSE_INVALID_BOARD;
+            }
+
+            if ((start_address == NULL) || (record_size == NULL) || (updates == NULL))
+            {
+                return NUSE_INVALID_POINTER;
+            }
+        #endif
+
+        *start_address = NUSE_Board_Data[board];
+        *record_size = NUSE_Board_Size[board];
+        *updates = NUSE_Board_Sequence[board];
+
+        return NUSE_SUCCESS;
+    }
+
+#endif
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Board_Count()
+*
+*   DESCRIPTION
+*
+*       Returns the number of state boards in the system
+*       Code is trivial, as the number of state boards is fixed in Nucleus SE,
+*       so a constant is returned
+*
+*   INPUTS
+*
+*       (none)
+*
+*   RETURNS
+*
+*       U8 value        number of state boards in the system [Value: 0-15]
+*
+*   OTHER OUTPUTS
+*
+*       (none)
+*
+*************************************************************************/
+
+#if NUSE_BOARD_COUNT || NUSE_INCLUDE_EVERYTHING
+
+    U8 NUSE_Board_Count(void)
+    {
+        return NUSE_BOARD_NUMBER;
+    }
+
+#endif
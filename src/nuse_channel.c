@@ -0,0 +1,372 @@
+/*** Channel handling APIs ***/
+
+/************************************************************************
+*
+*   This file contains the definitions of functions concerned with the
+*   handling of channels in Nucleus SE:
+*
+*   NUSE_Channel_Put()
+*   NUSE_Channel_Get()
+*   NUSE_Channel_Information()
+*   NUSE_Channel_Count()
+*
+*   A channel is a single-producer/single-consumer ring of (type ADDR)
+*   messages, intended for passing data from an ISR to a task
+*   The producer only ever writes the head index and the consumer only
+*   ever writes the tail index, so neither side needs a critical section
+*   to transfer data; interrupts are only masked when the consumer must
+*   block on an empty channel, or when the producer must wake it
+*   The slots are accessed as volatile, so the compiler keeps each data
+*   access in order with the index update which publishes or releases it
+*   A channel of size n holds up to n-1 messages, so the size must be at
+*   least 2; this is checked by the APIs if NUSE_API_PARAMETER_CHECKING
+*
+************************************************************************/
+
+#include "nuse_config.h"
+#include "nuse_codes.h"
+#include "nuse_types.h"
+#include "nuse_data.h"
+#include "nuse_prototypes.h"
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Channel_Put()
+*
+*   DESCRIPTION
+*
+*       Puts a single (type ADDR) message into the channel - producer side
+*       The message is stored before the head index is advanced, so the consumer
+*       never sees a slot that has not been written
+*       If the consumer task is blocked on the channel, it is woken
+*       Never blocks, so may be called from an ISR; if blocking is enabled,
+*       that must be a managed ISR, as the consumer may need to be woken
+*
+*   INPUTS
+*
+*       NUSE_CHANNEL channel    index of channel to be used
+*       ADDR *message           pointer to the message to be sent
+*
+*   RETURNS
+*
+*       NUSE_SUCCESS            message successfully sent
+*       NUSE_CHANNEL_FULL       send failed as there was no room in the channel
+*       NUSE_INVALID_CHANNEL    specified channel index is invalid
+*       NUSE_INVALID_POINTER    message pointer [message] is NULL
+*       NUSE_INVALID_SIZE       the channel is configured with a size of less than 2
+*
+*   OTHER OUTPUTS
+*
+*       (none)
+*
+*************************************************************************/
+
+#if NUSE_CHANNEL_PUT || (NUSE_INCLUDE_EVERYTHING && (NUSE_CHANNEL_NUMBER != 0))
+
+    STATUS NUSE_Channel_Put(NUSE_CHANNEL channel, ADDR *message)
+    {
+        U8 head, next;
+
+        #if NUSE_API_PARAMETER_CHECKING
+            if (channel >= NUSE_CHANNEL_NUMBER)
+            {
+                return NUSE_INVALID_CHANNEL;
+            }
+
+            if (message == NULL)
+            {
+                return NUSE_INVALID_POINTER;
+            }
+
+            if (NUSE_Channel_Size[channel] < 2)                 /* would never hold a message */
+            {
+                return NUSE_INVALID_SIZE;
+            }
+        #endif
+
+        head = NUSE_Channel_Head[channel];
+        next = head + 1;
+        if (next == NUSE_Channel_Size[channel])
+        {
+            next = 0;
+        }
+
+        if (next == NUSE_Channel_Tail[channel])                 /* channel full */
+        {
+            return NUSE_CHANNEL_FULL;
+        }
+
+        ((volatile ADDR *)NUSE_Channel_Data[channel])[head] = *message;
+        NUSE_Channel_Head[channel] = next;                      /* publish - must follow the data write */
+
+        #if NUSE_BLOCKING_ENABLE
+            if (NUSE_Channel_Waiter[channel] != NUSE_NO_TASK)   /* consumer may be blocked */
+            {
+                NUSE_TASK task;
+
+                NUSE_CS_Enter();
+
+                task = NUSE_Channel_Waiter[channel];
+                if (task != NUSE_NO_TASK)
+                {
+                    NUSE_Channel_Waiter[channel] = NUSE_NO_TASK;
+                    NUSE_Task_Blocking_Return[task] = NUSE_SUCCESS;
+                    NUSE_Wake_Task(task);
+                }
+
+                NUSE_CS_Exit();
+            }
+        #endif
+
+        return NUSE_SUCCESS;
+    }
+
+#endif
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Channel_Get()
+*
+*   DESCRIPTION
+*
+*       Gets a single (type ADDR) message from the channel - consumer side
+*       The message is read before the tail index is advanced, so the producer
+*       never overwrites a slot that is still being read
+*       Only one task may get from a given channel
+*       A critical section is only entered if the task needs to block
+*
+*   INPUTS
+*
+*       NUSE_CHANNEL channel    index of channel to be used
+*       ADDR *message           pointer to storage for message to be received
+*       U8 suspend              task suspend option - must be NUSE_NO_SUSPEND or NUSE_SUSPEND
+*                               depending upon the setting of NUSE_BLOCKING_ENABLE
+*
+*   RETURNS
+*
+*       NUSE_SUCCESS            message successfully received
+*       NUSE_CHANNEL_EMPTY      receive failed as no message was waiting
+*       NUSE_INVALID_CHANNEL    specified channel index is invalid
+*       NUSE_INVALID_POINTER    message pointer [message] is NULL
+*       NUSE_INVALID_SUSPEND    task suspend option is not set to NUSE_NO_SUSPEND or NUSE_SUSPEND
+*       NUSE_INVALID_SIZE       the channel is configured with a size of less than 2
+*
+*   OTHER OUTPUTS
+*
+*       ADDR *message           received message
+*
+*************************************************************************/
+
+#if NUSE_CHANNEL_GET || (NUSE_INCLUDE_EVERYTHING && (NUSE_CHANNEL_NUMBER != 0))
+
+    STATUS NUSE_Channel_Get(NUSE_CHANNEL channel, ADDR *message, U8 suspend)
+    {
+        U8 tail;
+
+        #if NUSE_API_PARAMETER_CHECKING
+            if (channel >= NUSE_CHANNEL_NUMBER)
+            {
+                return NUSE_INVALID_CHANNEL;
+            }
+
+            if (message == NULL)
+            {
+                return NUSE_INVALID_POINTER;
+            }
+
+            if (NUSE_Channel_Size[channel] < 2)                 /* would never hold a message */
+            {
+                return NUSE_INVALID_SIZE;
+            }
+
+            #if NUSE_BLOCKING_ENABLE
+                if ((suspend != NUSE_NO_SUSPEND) && (suspend != NUSE_SUSPEND))
+                {
+                    return NUSE_INVALID_SUSPEND;
+                }
+            #else
+                if (suspend != NUSE_NO_SUSPEND)
+                {
+                    return NUSE_INVALID_SUSPEND;
+                }
+            #endif
+        #endif
+
+        tail = NUSE_Channel_Tail[channel];
+
+        #if NUSE_BLOCKING_ENABLE
+            while (tail == NUSE_Channel_Head[channel])              /* channel empty */
+            {
+                if (suspend == NUSE_NO_SUSPEND)
+                {
+                    return NUSE_CHANNEL_EMPTY;
+                }
+
+                NUSE_CS_Enter();
+
+                if (tail == NUSE_Channel_Head[channel])             /* still empty with interrupts masked */
+                {                                                   /* block task */
+                    NUSE_Channel_Waiter[channel] = NUSE_Task_Active;
+                    NUSE_Suspend_Task(NUSE_Task_Active, (channel << 4) | NUSE_CHANNEL_SUSPEND);
+                }
+
+                NUSE_CS_Exit();
+            }
+        #else
+            if (tail == NUSE_Channel_Head[channel])                 /* channel empty */
+            {
+                return NUSE_CHANNEL_EMPTY;
+            }
+        #endif
+
+        *message = ((volatile ADDR *)NUSE_Channel_Data[channel])[tail++];
+        if (tail == NUSE_Channel_Size[channel])
+        {
+            tail = 0;
+        }
+        NUSE_Channel_Tail[channel] = tail;                          /* release - must follow the data read */
+
+        return NUSE_SUCCESS;
+    }
+
+#endif
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Channel_Information()
+*
+*   DESCRIPTION
+*
+*       Returns a number of items of data about a channel
+*       The values are a snapshot, as the producer and consumer do not lock the channel
+*
+*   INPUTS
+*
+*       NUSE_CHANNEL channel        index of channel about which information is required
+*       ADDR *start_address         pointer to storage for the start address of the channel
+*       U8 *channel_size            pointer to storage for the size of the channel
+*       U8 *available               pointer to storage for the number of free channel entries
+*       U8 *messages                pointer to storage for the number of messages in the channel
+*       U8 *tasks_waiting           pointer to storage for number of waiting tasks [if used]
+*       NUSE_TASK *first_task       pointer to storage for the waiting task [if used]
+*
+*   RETURNS
+*
+*       NUSE_SUCCESS                the channel status was successfully returned
+*       NUSE_INVALID_CHANNEL        the channel index was not valid
+*       NUSE_INVALID_POINTER        one or more of the pointer parameters was NULL
+*
+*   OTHER OUTPUTS
+*
+*       ADDR *start_address         start address of the channel data area
+*       U8 *channel_size            size of the channel [number of messages it can hold]
+*       U8 *available               number of unused/available channel entries
+*       U8 *messages                number of messages in the channel
+*       U8 *tasks_waiting           number of waiting tasks [0 or 1 if used, otherwise 0]
+*       NUSE_TASK *first_task       waiting task [if used, otherwise 0]
+*
+*************************************************************************/
+
+#if NUSE_CHANNEL_INFORMATION || (NUSE_INCLUDE_EVERYTHING && (NUSE_CHANNEL_NUMBER != 0))
+
+    STATUS NUSE_Channel_Information(NUSE_CHANNEL channel, ADDR *start_address, U8 *channel_size, U8 *available, U8 *messages, U8 *tasks_waiting, NUSE_TASK *first_task)
+    {
+        U8 head, tail, items;
+
+        #if NUSE_API_PARAMETER_CHECKING
+            if (channel >= NUSE_CHANNEL_NUMBER)
+            {
+                return NUSE_INVALID_CHANNEL;
+            }
+
+            if ((start_address == NULL) || (channel_size == NULL) || (available == NULL) || (messages == NULL) || (tasks_waiting == NULL) || (first_task == NULL))
+            {
+                return NUSE_INVALID_POINTER;
+            }
+        #endif
+
+        head = NUSE_Channel_Head[channel];
+        tail = NUSE_Channel_Tail[channel];
+        if (head >= tail)
+        {
+            items = head - tail;
+        }
+        else
+        {
+            items = NUSE_Channel_Size[channel] - tail + head;
+        }
+
+        *start_address = NUSE_Channel_Data[channel];
+        *channel_size = NUSE_Channel_Size[channel] - 1;
+        *available = NUSE_Channel_Size[channel] - 1 - items;
+        *messages = items;
+
+        #if NUSE_BLOCKING_ENABLE
+
+            if (NUSE_Channel_Waiter[channel] != NUSE_NO_TASK)
+            {
+                *tasks_waiting = 1;
+                *first_task = NUSE_Channel_Waiter[channel];
+            }
+            else
+            {
+                *tasks_waiting = 0;
+                *first_task = 0;
+            }
+
+        #else
+
+            *tasks_waiting = 0;
+            *first_task = 0;
+
+        #endif
+
+        return NUSE_SUCCESS;
+    }
+
+#endif
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Channel_Count()
+*
+*   DESCRIPTION
+*
+*       Returns the number of channels in the system
+*       Code is trivial, as the number of channels is fixed in Nucleus SE,
+*       so a constant is returned
+*
+*   INPUTS
+*
+*       (none)
+*
+*   RETURNS
+*
+*       U8 value        number of channels in the system [Value: 0-15]
+*
+*   OTHER OUTPUTS
+*
+*       (none)
+*
+*************************************************************************/
+
+#if NUSE_CHANNEL_COUNT || NUSE_INCLUDE_EVERYTHING
+
+    U8 NUSE_Channel_Count(void)
+    {
+        return NUSE_CHANNEL_NUMBER;
+    }
+
+#endif
@@ -23,6 +23,11 @@
 #define NUSE_INVALID_TASK (-25)
 #define NUSE_NOT_TERMINATED (-38)
 #define NUSE_INVALID_RESUME (-20)
+#define NUSE_STACK_OVERFLOW (-65)
+#define NUSE_INVALID_SITE (-66)
+#define NUSE_INVALID_LATENCY (-67)
+#define NUSE_DEADLOCK (-68)
+#define NUSE_INVALID_PERIOD (-69)
 
 #define NUSE_READY (0)
 #define NUSE_PURE_SUSPEND (1)
@@ -35,10 +40,27 @@
 #define NUSE_EVENT_SUSPEND (7)
 #define NUSE_SEMAPHORE_SUSPEND (6)
 #define NUSE_PARTITION_SUSPEND (8)
+#define NUSE_CHANNEL_SUSPEND (9)
+#define NUSE_SIGNAL_SUSPEND (10)
+#define NUSE_MULTIPLE_SUSPEND (13)
+#define NUSE_BINARY_SUSPEND (14)
+#define NUSE_MEMORY_SUSPEND (15)
+
+#define NUSE_INVALID_OBJECT (-64)
+
+/* NUSE_Task_Wait_Multiple() list entries - encoded as for NUSE_Task_Status */
+#define NUSE_WAIT_MAILBOX(mailbox) (((mailbox) << 4) | NUSE_MAILBOX_SUSPEND)
+#define NUSE_WAIT_QUEUE(queue) (((queue) << 4) | NUSE_QUEUE_SUSPEND)
+#define NUSE_WAIT_PIPE(pipe) (((pipe) << 4) | NUSE_PIPE_SUSPEND)
+#define NUSE_WAIT_SEMAPHORE(semaphore) (((semaphore) << 4) | NUSE_SEMAPHORE_SUSPEND)
+#define NUSE_WAIT_EVENT_GROUP(group) (((group) << 4) | NUSE_EVENT_SUSPEND)
+#define NUSE_WAIT_PARTITION_POOL(pool) (((pool) << 4) | NUSE_PARTITION_SUSPEND)   /* NUSE_Wait_Statistics() only */
+#define NUSE_WAIT_BINARY_SEMAPHORE(semaphore) (((semaphore) << 4) | NUSE_BINARY_SUSPEND)   /* NUSE_Deadlock_Information() only */
 
 #define NUSE_INVALID_POOL (-16)
 #define NUSE_INVALID_POINTER (-15)
 #define NUSE_NO_PARTITION (-34)
+#define NUSE_NO_MEMORY (-32)
 #define NUSE_TIMEOUT (-50)
 
 #define NUSE_INVALID_MAILBOX (-10)
@@ -59,6 +81,12 @@
 #define NUSE_PIPE_WAS_RESET (-42)
 #define NUSE_PIPE_FULL (-41)
 
+#define NUSE_INVALID_CHANNEL (-60)
+#define NUSE_CHANNEL_EMPTY (-61)
+#define NUSE_CHANNEL_FULL (-62)
+
+#define NUSE_INVALID_BOARD (-63)
+
 #define NUSE_INVALID_SEMAPHORE (-21)
 #define NUSE_SEMAPHORE_WAS_RESET (-49)
 #define NUSE_UNAVAILABLE (-51)
@@ -85,5 +113,19 @@
 #define NUSE_NISR_CONTEXT (2)
 #define NUSE_MISR_CONTEXT (3)
 
+/* Trace record event types - 0 marks an unused record */
+#define NUSE_TRACE_SWITCH (1)
+#define NUSE_TRACE_WAKE (2)
+#define NUSE_TRACE_SUSPEND (3)
+#define NUSE_TRACE_API_ENTRY (4)
+#define NUSE_TRACE_API_EXIT (5)
+#define NUSE_TRACE_ISR_ENTRY (6)
+#define NUSE_TRACE_ISR_EXIT (7)
+#define NUSE_TRACE_TIMER (8)
+
+/* NUSE_Latency_xxx() measurement selection */
+#define NUSE_INTERRUPT_LATENCY (0)
+#define NUSE_SWITCH_LATENCY (1)
+
 #endif  /* ! _NUSE_CODES_H_ */
 
@@ -37,8 +37,30 @@
 
 /*** Partition pools ***/
 
-#if NUSE_PARTITION_POOL_NUMBER > 16
-    #error NUSE: invalid number of partition pools - must be 0-16
+#if (NUSE_PARTITION_ALIGNMENT == 0) || NUSE_BLOCKING_ENABLE
+    #if NUSE_PARTITION_POOL_NUMBER > 16
+        #error NUSE: invalid number of partition pools - must be 0-16
+    #endif
+#else                                       /* no status byte or task status to hold pool index */
+    #if NUSE_PARTITION_POOL_NUMBER > 255
+        #error NUSE: invalid number of partition pools - must be 0-255
+    #endif
+#endif
+
+#if (NUSE_PARTITION_COUNT_WIDTH != 8) && (NUSE_PARTITION_COUNT_WIDTH != 16)
+    #error NUSE: invalid partition count width - must be 8 or 16
+#endif
+
+#if NUSE_PARTITION_ALIGNMENT & (NUSE_PARTITION_ALIGNMENT - 1)
+    #error NUSE: invalid partition alignment - must be 0 or a power of 2
+#endif
+
+#if NUSE_PARTITION_POOL_STATISTICS && !NUSE_PARTITION_ALLOCATE_SIZE
+    #error NUSE: NUSE_Partition_Pool_Statistics() selected - NUSE_Partition_Allocate_Size() not enabled
+#endif
+
+#if NUSE_PARTITION_SEND && !NUSE_QUEUE_SEND
+    #error NUSE: NUSE_Partition_Send() selected - NUSE_Queue_Send() not enabled
 #endif
 
 #if NUSE_PARTITION_POOL_NUMBER == 0
@@ -55,6 +77,48 @@
         #error NUSE: NUSE_Partition_Pool_Information() enabled - no partition pools configured
     #endif
 
+    #if NUSE_PARTITION_ALLOCATE_SIZE
+        #error NUSE: NUSE_Partition_Allocate_Size() enabled - no partition pools configured
+    #endif
+
+    #if NUSE_PARTITION_POOL_STATISTICS
+        #error NUSE: NUSE_Partition_Pool_Statistics() enabled - no partition pools configured
+    #endif
+
+    #if NUSE_PARTITION_REFERENCE
+        #error NUSE: NUSE_Partition_Reference() enabled - no partition pools configured
+    #endif
+
+    #if NUSE_PARTITION_SEND
+        #error NUSE: NUSE_Partition_Send() enabled - no partition pools configured
+    #endif
+
+#endif
+
+/*** Memory pools ***/
+
+#if NUSE_MEMORY_POOL_NUMBER > 16
+    #error NUSE: invalid number of memory pools - must be 0-16
+#endif
+
+/* memory pools [ROM data in nuse_config.c] must be at least 8 bytes and start */
+/* on a 4 byte boundary - a pool which is not is left empty by NUSE_Init() and  */
+/* rejected by NUSE_Memory_Allocate() if NUSE_API_PARAMETER_CHECKING            */
+
+#if NUSE_MEMORY_POOL_NUMBER == 0
+
+    #if NUSE_MEMORY_ALLOCATE
+        #error NUSE: NUSE_Memory_Allocate() enabled - no memory pools configured
+    #endif
+
+    #if NUSE_MEMORY_DEALLOCATE
+        #error NUSE: NUSE_Memory_Deallocate() enabled - no memory pools configured
+    #endif
+
+    #if NUSE_MEMORY_POOL_INFORMATION
+        #error NUSE: NUSE_Memory_Pool_Information() enabled - no memory pools configured
+    #endif
+
 #endif
 
 /*** Mailboxes ***/
@@ -77,6 +141,10 @@
         #error NUSE: NUSE_Mailbox_Reset() enabled - no mailboxes configured
     #endif
 
+    #if NUSE_MAILBOX_OVERWRITE
+        #error NUSE: NUSE_Mailbox_Overwrite() enabled - no mailboxes configured
+    #endif
+
     #if NUSE_MAILBOX_SEND
         #error NUSE: NUSE_Mailbox_Send() enabled - no mailboxes configured
     #endif
@@ -107,12 +175,20 @@
         #error NUSE: NUSE_Queue_Jam() enabled - no queues configured
     #endif
 
+    #if NUSE_QUEUE_BROADCAST
+        #error NUSE: NUSE_Queue_Broadcast() enabled - no queues configured
+    #endif
+
     #if NUSE_QUEUE_SEND
         #error NUSE: NUSE_Queue_Send() enabled - no queues configured
     #endif
 
 #endif
 
+#if NUSE_QUEUE_BROADCAST && !NUSE_QUEUE_SEND
+    #error NUSE: NUSE_Queue_Broadcast() selected - NUSE_Queue_Send() not enabled
+#endif
+
 /*** Pipes ***/
 
 #if NUSE_PIPE_NUMBER > 16
@@ -137,18 +213,77 @@
         #error NUSE: NUSE_Pipe_Jam() enabled - no pipes configured
     #endif
 
+    #if NUSE_PIPE_BROADCAST
+        #error NUSE: NUSE_Pipe_Broadcast() enabled - no pipes configured
+    #endif
+
     #if NUSE_PIPE_SEND
         #error NUSE: NUSE_Pipe_Send() enabled - no pipes configured
     #endif
 
 #endif
 
+#if NUSE_PIPE_BROADCAST && !NUSE_PIPE_SEND
+    #error NUSE: NUSE_Pipe_Broadcast() selected - NUSE_Pipe_Send() not enabled
+#endif
+
+/*** Channels ***/
+
+#if NUSE_CHANNEL_NUMBER > 16
+    #error NUSE: invalid number of channels - must be 0-16
+#endif
+
+/* channel sizes [ROM data in nuse_config.c] must be at least 2 - checked by */
+/* NUSE_Channel_Put() and NUSE_Channel_Get() if NUSE_API_PARAMETER_CHECKING   */
+
+#if NUSE_CHANNEL_NUMBER == 0
+
+    #if NUSE_CHANNEL_INFORMATION
+        #error NUSE: NUSE_Channel_Information() enabled - no channels configured
+    #endif
+
+    #if NUSE_CHANNEL_GET
+        #error NUSE: NUSE_Channel_Get() enabled - no channels configured
+    #endif
+
+    #if NUSE_CHANNEL_PUT
+        #error NUSE: NUSE_Channel_Put() enabled - no channels configured
+    #endif
+
+#endif
+
+/*** State Boards ***/
+
+#if NUSE_BOARD_NUMBER > 16
+    #error NUSE: invalid number of state boards - must be 0-16
+#endif
+
+#if NUSE_BOARD_NUMBER == 0
+
+    #if NUSE_BOARD_INFORMATION
+        #error NUSE: NUSE_Board_Information() enabled - no state boards configured
+    #endif
+
+    #if NUSE_BOARD_READ
+        #error NUSE: NUSE_Board_Read() enabled - no state boards configured
+    #endif
+
+    #if NUSE_BOARD_WRITE
+        #error NUSE: NUSE_Board_Write() enabled - no state boards configured
+    #endif
+
+#endif
+
 /*** Semaphores ***/
 
 #if NUSE_SEMAPHORE_NUMBER > 16
     #error NUSE: invalid number of semaphores - must be 0-16
 #endif
 
+#if (NUSE_SEMAPHORE_WIDTH != 8) && (NUSE_SEMAPHORE_WIDTH != 16) && (NUSE_SEMAPHORE_WIDTH != 32)
+    #error NUSE: invalid semaphore width - must be 8, 16 or 32
+#endif
+
 #if NUSE_SEMAPHORE_NUMBER == 0
 
     #if NUSE_SEMAPHORE_OBTAIN
@@ -169,12 +304,32 @@
 
 #endif
 
+#if NUSE_BINARY_SEMAPHORE_NUMBER > 16
+    #error NUSE: invalid number of binary semaphores - must be 0-16
+#endif
+
+#if NUSE_BINARY_SEMAPHORE_NUMBER == 0
+
+    #if NUSE_BINARY_SEMAPHORE_OBTAIN
+        #error NUSE: NUSE_Binary_Semaphore_Obtain() enabled - no binary semaphores configured
+    #endif
+
+    #if NUSE_BINARY_SEMAPHORE_RELEASE
+        #error NUSE: NUSE_Binary_Semaphore_Release() enabled - no binary semaphores configured
+    #endif
+
+#endif
+
 /*** Event groups ***/
 
 #if NUSE_EVENT_GROUP_NUMBER > 16
     #error NUSE: invalid number of event groups - must be 0-16
 #endif
 
+#if (NUSE_EVENT_GROUP_WIDTH != 8) && (NUSE_EVENT_GROUP_WIDTH != 16) && (NUSE_EVENT_GROUP_WIDTH != 32)
+    #error NUSE: invalid event group width - must be 8, 16 or 32
+#endif
+
 #if NUSE_EVENT_GROUP_NUMBER == 0
 
     #if NUSE_EVENT_GROUP_INFORMATION
@@ -204,6 +359,10 @@
         #error NUSE: NUSE_Signals_Send() enabled - signals not configured
     #endif
 
+    #if NUSE_SIGNALS_WAIT
+        #error NUSE: NUSE_Signals_Wait() enabled - signals not configured
+    #endif
+
 #endif
 
 
@@ -277,5 +436,142 @@
     #error NUSE: blocking API calls enabled with RTC scheduler - not supported
 #endif
 
+#if NUSE_STACK_PAINTING && (NUSE_SCHEDULER_TYPE == NUSE_RUN_TO_COMPLETION_SCHEDULER)
+    #error NUSE: stack painting enabled with RTC scheduler - tasks do not have their own stacks
+#endif
+
+#if NUSE_STACK_CHECK_SWITCH && !NUSE_STACK_PAINTING
+    #error NUSE: stack check at context switch enabled - stack painting not enabled
+#endif
+
+#if NUSE_TASK_STACK_HIGH_WATER && !NUSE_STACK_PAINTING
+    #error NUSE: NUSE_Task_Stack_High_Water() enabled - stack painting not enabled
+#endif
+
+#if NUSE_TASK_RUNTIME && !NUSE_RUNTIME_SUPPORT
+    #error NUSE: NUSE_Task_Runtime() enabled - run time accounting not enabled
+#endif
+
+#if NUSE_TASK_LOAD && !NUSE_RUNTIME_SUPPORT
+    #error NUSE: NUSE_Task_Load() enabled - run time accounting not enabled
+#endif
+
+#if NUSE_TASK_RUNTIME_RESET && !NUSE_RUNTIME_SUPPORT
+    #error NUSE: NUSE_Task_Runtime_Reset() enabled - run time accounting not enabled
+#endif
+
+/*** Trace ***/
+
+#if NUSE_TRACE_SUPPORT
+    #if (NUSE_TRACE_SIZE == 0) || (NUSE_TRACE_SIZE & (NUSE_TRACE_SIZE - 1)) || (NUSE_TRACE_SIZE > 32768)
+        #error NUSE: invalid trace buffer size - must be a power of 2, up to 32768
+    #endif
+#endif
+
+#if NUSE_TRACE_API && !NUSE_TRACE_SUPPORT
+    #error NUSE: API call tracing enabled - trace support not enabled
+#endif
+
+/*** Statistics ***/
+
+#if NUSE_WAIT_STATISTICS_SUPPORT
+    #if !NUSE_BLOCKING_ENABLE
+        #error NUSE: wait statistics enabled - blocking not enabled
+    #endif
+    #if (NUSE_QUEUE_NUMBER + NUSE_PIPE_NUMBER + NUSE_MAILBOX_NUMBER + NUSE_SEMAPHORE_NUMBER + NUSE_EVENT_GROUP_NUMBER + NUSE_PARTITION_POOL_NUMBER) == 0
+        #error NUSE: wait statistics enabled - no objects on which tasks may block
+    #endif
+#endif
+
+#if NUSE_WAIT_STATISTICS && !NUSE_WAIT_STATISTICS_SUPPORT
+    #error NUSE: NUSE_Wait_Statistics() enabled - wait statistics not enabled
+#endif
+
+#if NUSE_WAIT_STATISTICS_RESET && !NUSE_WAIT_STATISTICS_SUPPORT
+    #error NUSE: NUSE_Wait_Statistics_Reset() enabled - wait statistics not enabled
+#endif
+
+#if NUSE_CS_PROFILE_SUPPORT
+    #if (NUSE_CS_PROFILE_SITES == 0) || (NUSE_CS_PROFILE_SITES > 255)
+        #error NUSE: invalid number of critical section profile entries - must be 1-255
+    #endif
+#endif
+
+#if NUSE_CS_PROFILE_SITE && !NUSE_CS_PROFILE_SUPPORT
+    #error NUSE: NUSE_CS_Profile_Site() enabled - critical section profiling not enabled
+#endif
+
+#if NUSE_CS_PROFILE_HISTOGRAM && !NUSE_CS_PROFILE_SUPPORT
+    #error NUSE: NUSE_CS_Profile_Histogram() enabled - critical section profiling not enabled
+#endif
+
+#if NUSE_CS_PROFILE_RESET && !NUSE_CS_PROFILE_SUPPORT
+    #error NUSE: NUSE_CS_Profile_Reset() enabled - critical section profiling not enabled
+#endif
+
+#if NUSE_LATENCY_SUPPORT
+    #if NUSE_SCHEDULER_TYPE == NUSE_RUN_TO_COMPLETION_SCHEDULER
+        #error NUSE: latency measurement enabled with RTC scheduler - there is no context switch
+    #endif
+    #if !NUSE_SUSPEND_ENABLE
+        #error NUSE: latency measurement enabled - task suspend not enabled
+    #endif
+#endif
+
+#if NUSE_LATENCY_HISTOGRAM && !NUSE_LATENCY_SUPPORT
+    #error NUSE: NUSE_Latency_Histogram() enabled - latency measurement not enabled
+#endif
+
+#if NUSE_LATENCY_PERCENTILE && !NUSE_LATENCY_SUPPORT
+    #error NUSE: NUSE_Latency_Percentile() enabled - latency measurement not enabled
+#endif
+
+#if NUSE_LATENCY_RESET && !NUSE_LATENCY_SUPPORT
+    #error NUSE: NUSE_Latency_Reset() enabled - latency measurement not enabled
+#endif
+
+#if NUSE_DEADLOCK_DETECTION_SUPPORT
+    #if !NUSE_BLOCKING_ENABLE
+        #error NUSE: deadlock detection enabled - blocking not enabled
+    #endif
+    #if (NUSE_SEMAPHORE_NUMBER + NUSE_BINARY_SEMAPHORE_NUMBER + NUSE_PARTITION_POOL_NUMBER) == 0
+        #error NUSE: deadlock detection enabled - no objects which tasks may hold
+    #endif
+#endif
+
+#if NUSE_DEADLOCK_PARTITIONS
+    #if !NUSE_DEADLOCK_DETECTION_SUPPORT
+        #error NUSE: partition pool deadlock detection enabled - deadlock detection not enabled
+    #endif
+    #if NUSE_PARTITION_POOL_NUMBER == 0
+        #error NUSE: partition pool deadlock detection enabled - no partition pools configured
+    #endif
+#endif
+
+#if NUSE_DEADLOCK_INFORMATION && !NUSE_DEADLOCK_DETECTION_SUPPORT
+    #error NUSE: NUSE_Deadlock_Information() enabled - deadlock detection not enabled
+#endif
+
+#if NUSE_WATCHDOG_SUPPORT
+    #if NUSE_SCHEDULER_TYPE == NUSE_RUN_TO_COMPLETION_SCHEDULER
+        #error NUSE: task watchdog enabled with RTC scheduler - a task cannot be reset
+    #endif
+    #if !NUSE_SUSPEND_ENABLE
+        #error NUSE: task watchdog enabled - task suspend not enabled
+    #endif
+#endif
+
+#if NUSE_WATCHDOG_START && !NUSE_WATCHDOG_SUPPORT
+    #error NUSE: NUSE_Watchdog_Start() enabled - task watchdog not enabled
+#endif
+
+#if NUSE_WATCHDOG_CHECK_IN && !NUSE_WATCHDOG_SUPPORT
+    #error NUSE: NUSE_Watchdog_Check_In() enabled - task watchdog not enabled
+#endif
+
+#if NUSE_WATCHDOG_STOP && !NUSE_WATCHDOG_SUPPORT
+    #error NUSE: NUSE_Watchdog_Stop() enabled - task watchdog not enabled
+#endif
+
 #endif  /* ! _NUSE_CONFIG_CHECK_H_ */
 
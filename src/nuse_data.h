@@ -35,6 +35,35 @@ extern RAM NUSE_TASK NUSE_Task_Saved_State;
     extern RAM U16 NUSE_Time_Slice_Ticks;
 #endif
 
+/* Run time accounting - the span since the last switch is charged to the outgoing task */
+
+#if NUSE_RUNTIME_SUPPORT
+    extern RAM U32 NUSE_Run_Time_Switch;        /* cycle counter value at last context switch */
+    extern RAM U32 NUSE_Run_Time_Start;         /* cycle counter value when accounting started */
+
+    #define NUSE_RUN_TIME_SWITCH() \
+        { \
+            U32 now = NUSE_CYCLE_COUNTER(); \
+            NUSE_Task_Run_Time[NUSE_Task_Active] += now - NUSE_Run_Time_Switch; \
+            NUSE_Run_Time_Switch = now; \
+        }
+#else
+    #define NUSE_RUN_TIME_SWITCH()
+#endif
+
+/* Trace records - time stamp [16 bits], event type [4], task index [4], event data [8] */
+
+#if NUSE_TRACE_SUPPORT
+    extern RAM U32 NUSE_Trace_Buffer[NUSE_TRACE_SIZE];
+    extern RAM U16 NUSE_Trace_Index;
+
+    #define NUSE_TRACE(event, task, data) \
+        NUSE_Trace_Buffer[NUSE_Trace_Index++ & (NUSE_TRACE_SIZE - 1)] = \
+            ((U32)(U16)NUSE_TRACE_TIMESTAMP() << 16) | ((U32)(event) << 12) | ((U32)(task) << 8) | (U8)(data)
+#else
+    #define NUSE_TRACE(event, task, data)
+#endif
+
 /* Kernel object data structures */
 
 /* Task ROM Data */
@@ -72,10 +101,41 @@ extern ROM ADDR NUSE_Task_Start_Address[NUSE_TASK_NUMBER];
     extern RAM U8 NUSE_Task_Blocking_Return[NUSE_TASK_NUMBER];
 #endif
 
+#if (NUSE_QUEUE_BROADCAST || NUSE_PIPE_BROADCAST || NUSE_INCLUDE_EVERYTHING) && NUSE_BLOCKING_ENABLE
+    extern RAM ADDR NUSE_Task_Receive_Buffer[NUSE_TASK_NUMBER];
+#endif
+
+#if NUSE_TASK_WAIT_MULTIPLE || NUSE_INCLUDE_EVERYTHING
+    extern RAM U8 *NUSE_Task_Wait_List[NUSE_TASK_NUMBER];
+    #if NUSE_EVENT_GROUP_NUMBER != 0
+        extern RAM NUSE_EVENT_FLAGS *NUSE_Task_Wait_Events[NUSE_TASK_NUMBER];   /* requested flags for each list entry */
+        extern RAM OPTION *NUSE_Task_Wait_Operations[NUSE_TASK_NUMBER];         /* and operation */
+    #endif
+#endif
+
+#if (NUSE_TASK_WAIT_MULTIPLE || NUSE_INCLUDE_EVERYTHING) && NUSE_BLOCKING_ENABLE
+    extern RAM U8 NUSE_Task_Wait_Count[NUSE_TASK_NUMBER];
+    extern RAM U8 NUSE_Multiple_Blocking_Count;     /* tasks blocked in NUSE_Task_Wait_Multiple() */
+#endif
+
 #if NUSE_SIGNAL_SUPPORT || NUSE_INCLUDE_EVERYTHING
     extern RAM U8 NUSE_Task_Signal_Flags[NUSE_TASK_NUMBER];
 #endif
 
+#if NUSE_RUNTIME_SUPPORT
+    extern RAM U32 NUSE_Task_Run_Time[NUSE_TASK_NUMBER];
+#endif
+
+#if NUSE_STACK_CHECK_SWITCH
+    extern RAM U16 NUSE_Task_Stack_Overflow;        /* bit set for each task found to have overflowed */
+#endif
+
+#define NUSE_STACK_PAINT_VALUE (0xa5a5a5a5UL)       /* unused stack words hold this value */
+
+#if (NUSE_SIGNALS_WAIT || NUSE_INCLUDE_EVERYTHING) && NUSE_BLOCKING_ENABLE
+    extern RAM U8 NUSE_Task_Signal_Mask[NUSE_TASK_NUMBER];
+#endif
+
 #if NUSE_SCHEDULE_COUNT_SUPPORT || NUSE_INCLUDE_EVERYTHING
     extern RAM U16 NUSE_Task_Schedule_Count[NUSE_TASK_NUMBER];
 #endif
@@ -85,12 +145,28 @@ extern ROM ADDR NUSE_Task_Start_Address[NUSE_TASK_NUMBER];
     /* Partition Pool ROM Data */
 
     extern ROM ADDR NUSE_Partition_Pool_Data_Address[NUSE_PARTITION_POOL_NUMBER];
-    extern ROM U8 NUSE_Partition_Pool_Partition_Number[NUSE_PARTITION_POOL_NUMBER];
+    extern ROM NUSE_PARTITION_COUNT NUSE_Partition_Pool_Partition_Number[NUSE_PARTITION_POOL_NUMBER];
     extern ROM U16 NUSE_Partition_Pool_Partition_Size[NUSE_PARTITION_POOL_NUMBER];
+    extern ROM NUSE_PARTITION_COUNT *NUSE_Partition_Pool_Free_List[NUSE_PARTITION_POOL_NUMBER];
+
+    #if NUSE_PARTITION_REFERENCE || NUSE_PARTITION_SEND || NUSE_INCLUDE_EVERYTHING
+        extern ROM U8 *NUSE_Partition_Pool_References[NUSE_PARTITION_POOL_NUMBER];
+    #endif
 
     /* Partition Pool RAM Data */
 
-    extern RAM U8 NUSE_Partition_Pool_Partition_Used[NUSE_PARTITION_POOL_NUMBER];
+    extern RAM NUSE_PARTITION_COUNT NUSE_Partition_Pool_Partition_Used[NUSE_PARTITION_POOL_NUMBER];
+    extern RAM NUSE_PARTITION_COUNT NUSE_Partition_Pool_Free_Head[NUSE_PARTITION_POOL_NUMBER];
+
+    #define NUSE_PARTITION_IN_USE ((NUSE_PARTITION_COUNT)~0)    /* free list entry for an allocated partition */
+
+    #if NUSE_PARTITION_ALLOCATE_SIZE || NUSE_INCLUDE_EVERYTHING
+
+        extern RAM U16 NUSE_Partition_Pool_Hits[NUSE_PARTITION_POOL_NUMBER];
+        extern RAM U16 NUSE_Partition_Pool_Fallbacks[NUSE_PARTITION_POOL_NUMBER];
+        extern RAM U16 NUSE_Partition_Pool_Failures[NUSE_PARTITION_POOL_NUMBER];
+
+    #endif
 
     #if NUSE_BLOCKING_ENABLE
 
@@ -100,6 +176,42 @@ extern ROM ADDR NUSE_Task_Start_Address[NUSE_TASK_NUMBER];
 
 #endif
 
+#if NUSE_MEMORY_POOL_NUMBER > 0
+
+    /* Memory Pool ROM Data */
+
+    extern ROM ADDR NUSE_Memory_Pool_Data_Address[NUSE_MEMORY_POOL_NUMBER];
+    extern ROM U16 NUSE_Memory_Pool_Size[NUSE_MEMORY_POOL_NUMBER];
+
+    /* Memory Pool RAM Data */
+
+    #define NUSE_MEMORY_FL_COUNT (13)       /* first level size classes - below 16 bytes, then each power of 2 */
+    #define NUSE_MEMORY_SL_COUNT (4)        /* second level divisions of each first level class */
+
+    extern RAM U16 NUSE_Memory_Pool_Free_Head[NUSE_MEMORY_POOL_NUMBER][NUSE_MEMORY_FL_COUNT * NUSE_MEMORY_SL_COUNT];
+    extern RAM U16 NUSE_Memory_Pool_FL_Map[NUSE_MEMORY_POOL_NUMBER];
+    extern RAM U8 NUSE_Memory_Pool_SL_Map[NUSE_MEMORY_POOL_NUMBER][NUSE_MEMORY_FL_COUNT];
+    extern RAM U16 NUSE_Memory_Pool_Available[NUSE_MEMORY_POOL_NUMBER];
+
+    #if NUSE_BLOCKING_ENABLE
+
+        extern RAM U8 NUSE_Memory_Pool_Blocking_Count[NUSE_MEMORY_POOL_NUMBER];
+
+    #endif
+
+    /* block header [type U16[]]: [0] block size, including header, with NUSE_MEMORY_FREE set if free */
+    /* [1] size of preceding block, 0 if first; free blocks also hold [2] next and [3] previous free block on list */
+
+    #define NUSE_MEMORY_HEADER (4)
+    #define NUSE_MEMORY_MINIMUM (8)
+    #define NUSE_MEMORY_FREE (1)
+    #define NUSE_MEMORY_NONE (0xffff)
+    #define NUSE_MEMORY_END(pool) (NUSE_Memory_Pool_Size[pool] & ~3)
+    #define NUSE_MEMORY_BLOCK(pool, offset) ((U16 *)((U8 *)NUSE_Memory_Pool_Data_Address[pool] + (offset)))
+    #define NUSE_MEMORY_VALID(pool) ((NUSE_Memory_Pool_Size[pool] >= NUSE_MEMORY_MINIMUM) && !((unsigned long)NUSE_Memory_Pool_Data_Address[pool] & 3))
+
+#endif
+
 #if NUSE_MAILBOX_NUMBER > 0
 
     /* Mailbox RAM Data */
@@ -158,15 +270,48 @@ extern ROM ADDR NUSE_Task_Start_Address[NUSE_TASK_NUMBER];
 
 #endif
 
+#if NUSE_CHANNEL_NUMBER > 0
+
+    /* Channel ROM Data */
+
+    extern ROM ADDR *NUSE_Channel_Data[NUSE_CHANNEL_NUMBER];
+    extern ROM U8 NUSE_Channel_Size[NUSE_CHANNEL_NUMBER];
+
+    /* Channel RAM Data */
+
+    extern RAM volatile U8 NUSE_Channel_Head[NUSE_CHANNEL_NUMBER];     /* written only by the producer */
+    extern RAM volatile U8 NUSE_Channel_Tail[NUSE_CHANNEL_NUMBER];     /* written only by the consumer */
+
+    #if NUSE_BLOCKING_ENABLE
+
+        extern RAM volatile NUSE_TASK NUSE_Channel_Waiter[NUSE_CHANNEL_NUMBER];
+
+    #endif
+
+#endif
+
+#if NUSE_BOARD_NUMBER > 0
+
+    /* State Board ROM Data */
+
+    extern ROM U8 *NUSE_Board_Data[NUSE_BOARD_NUMBER];
+    extern ROM U8 NUSE_Board_Size[NUSE_BOARD_NUMBER];
+
+    /* State Board RAM Data */
+
+    extern RAM volatile U16 NUSE_Board_Sequence[NUSE_BOARD_NUMBER];   /* written only by the producer */
+
+#endif
+
 #if NUSE_SEMAPHORE_NUMBER > 0
 
     /* Semaphore ROM Data */
 
-    extern ROM U8 NUSE_Semaphore_Initial_Value[NUSE_SEMAPHORE_NUMBER];
+    extern ROM NUSE_SEMAPHORE_COUNTER NUSE_Semaphore_Initial_Value[NUSE_SEMAPHORE_NUMBER];
 
     /* Semaphore RAM Data */
 
-    extern RAM U8 NUSE_Semaphore_Counter[NUSE_SEMAPHORE_NUMBER];
+    extern RAM NUSE_SEMAPHORE_COUNTER NUSE_Semaphore_Counter[NUSE_SEMAPHORE_NUMBER];
 
     #if NUSE_BLOCKING_ENABLE
 
@@ -176,15 +321,35 @@ extern ROM ADDR NUSE_Task_Start_Address[NUSE_TASK_NUMBER];
 
 #endif
 
+#if NUSE_BINARY_SEMAPHORE_NUMBER > 0
+
+    /* Binary Semaphore ROM Data */
+
+    extern ROM U8 NUSE_Binary_Semaphore_Initial_Value[NUSE_BINARY_SEMAPHORE_NUMBER];
+
+    /* Binary Semaphore RAM Data */
+
+    extern RAM U16 NUSE_Binary_Semaphore_State;         /* one bit per semaphore - set if available */
+
+    #if NUSE_BLOCKING_ENABLE
+
+        extern RAM U16 NUSE_Binary_Semaphore_Waiters[NUSE_BINARY_SEMAPHORE_NUMBER];     /* one bit per blocked task */
+
+    #endif
+
+#endif
+
 #if NUSE_EVENT_GROUP_NUMBER > 0
 
     /* Event Group RAM Data */
 
-    extern RAM U8 NUSE_Event_Group_Data[NUSE_EVENT_GROUP_NUMBER];
+    extern RAM NUSE_EVENT_FLAGS NUSE_Event_Group_Data[NUSE_EVENT_GROUP_NUMBER];
 
     #if NUSE_BLOCKING_ENABLE
 
         extern RAM U8 NUSE_Event_Group_Blocking_Count[NUSE_EVENT_GROUP_NUMBER];
+        extern RAM NUSE_EVENT_FLAGS NUSE_Task_Event_Request[NUSE_TASK_NUMBER];   /* per blocked task */
+        extern RAM OPTION NUSE_Task_Event_Operation[NUSE_TASK_NUMBER];
 
     #endif
 
@@ -209,5 +374,145 @@ extern ROM ADDR NUSE_Task_Start_Address[NUSE_TASK_NUMBER];
 
 #endif
 
+#if NUSE_WAIT_STATISTICS_SUPPORT
+
+    /* Wait Statistics - one entry for each queue, pipe, mailbox, semaphore, event group and partition pool */
+
+    #define NUSE_WAIT_STATISTICS_QUEUE          0
+    #define NUSE_WAIT_STATISTICS_PIPE           (NUSE_WAIT_STATISTICS_QUEUE + NUSE_QUEUE_NUMBER)
+    #define NUSE_WAIT_STATISTICS_MAILBOX        (NUSE_WAIT_STATISTICS_PIPE + NUSE_PIPE_NUMBER)
+    #define NUSE_WAIT_STATISTICS_SEMAPHORE      (NUSE_WAIT_STATISTICS_MAILBOX + NUSE_MAILBOX_NUMBER)
+    #define NUSE_WAIT_STATISTICS_EVENT_GROUP    (NUSE_WAIT_STATISTICS_SEMAPHORE + NUSE_SEMAPHORE_NUMBER)
+    #define NUSE_WAIT_STATISTICS_PARTITION_POOL (NUSE_WAIT_STATISTICS_EVENT_GROUP + NUSE_EVENT_GROUP_NUMBER)
+    #define NUSE_WAIT_STATISTICS_NUMBER         (NUSE_WAIT_STATISTICS_PARTITION_POOL + NUSE_PARTITION_POOL_NUMBER)
+
+    #define NUSE_NO_WAIT_STATISTICS             0xff    /* object has no statistics entry */
+
+    extern RAM U16 NUSE_Wait_Blocks[NUSE_WAIT_STATISTICS_NUMBER];         /* number of times a task blocked */
+    extern RAM U8 NUSE_Wait_Max_Waiters[NUSE_WAIT_STATISTICS_NUMBER];     /* most tasks blocked at once */
+    extern RAM U32 NUSE_Wait_Total_Time[NUSE_WAIT_STATISTICS_NUMBER];     /* cycle counter units */
+    extern RAM U32 NUSE_Wait_Max_Time[NUSE_WAIT_STATISTICS_NUMBER];
+
+    #if NUSE_QUEUE_NUMBER > 0
+        extern RAM U8 NUSE_Queue_Peak[NUSE_QUEUE_NUMBER];               /* most items held at once */
+    #endif
+
+    #if NUSE_PIPE_NUMBER > 0
+        extern RAM U8 NUSE_Pipe_Peak[NUSE_PIPE_NUMBER];
+    #endif
+
+    #define NUSE_RECORD_PEAK(peak, items) \
+        { \
+            if ((items) > (peak)) \
+            { \
+                (peak) = (items); \
+            } \
+        }
+#else
+    #define NUSE_RECORD_PEAK(peak, items)
+#endif
+
+/* Histograms are log2 scaled - bucket n counts values from 2^n to 2^(n+1)-1 */
+/* [bucket 0 also counts 0 and the last bucket counts everything larger] */
+
+#define NUSE_HISTOGRAM_BUCKETS 16
+
+#if NUSE_CS_PROFILE_SUPPORT
+
+    /* Critical Section Profile - one entry for each critical section exit point seen */
+
+    extern RAM U32 NUSE_CS_Start;                               /* cycle counter value at entry */
+    extern RAM U32 NUSE_CS_Histogram[NUSE_HISTOGRAM_BUCKETS];
+    extern RAM U32 NUSE_CS_Worst;
+    extern RAM U8 NUSE_CS_Sites_Used;
+    extern RAM char *NUSE_CS_Site_File[NUSE_CS_PROFILE_SITES];
+    extern RAM U16 NUSE_CS_Site_Line[NUSE_CS_PROFILE_SITES];
+    extern RAM U16 NUSE_CS_Site_Count[NUSE_CS_PROFILE_SITES];
+    extern RAM U32 NUSE_CS_Site_Worst[NUSE_CS_PROFILE_SITES];
+
+#endif
+
+#if NUSE_LATENCY_SUPPORT
+
+    /* Latency Histograms - selected by NUSE_INTERRUPT_LATENCY or NUSE_SWITCH_LATENCY */
+
+    extern RAM U32 NUSE_Latency_ISR_Entry;
+    extern RAM U32 NUSE_Latency_Block_Time;
+    extern RAM U8 NUSE_Latency_Blocking;
+    extern RAM U8 NUSE_Latency_Switch_Pending;
+    extern RAM U16 NUSE_Latency_Resume_Hook;
+    extern RAM U16 NUSE_Latency_ISR_Woken;
+
+    extern RAM U32 NUSE_Task_Wake_Time[NUSE_TASK_NUMBER];           /* ISR entry time for a woken task */
+    extern RAM U32 NUSE_Latency_Counts[2][NUSE_HISTOGRAM_BUCKETS];
+    extern RAM U32 NUSE_Latency_Worst[2];
+
+    #define NUSE_LATENCY_WAKE(task) \
+        { \
+            if ((NUSE_Task_State == NUSE_MISR_CONTEXT) && (NUSE_Latency_Resume_Hook & ((U16)1 << (task)))) \
+            { \
+                NUSE_Task_Wake_Time[task] = NUSE_Latency_ISR_Entry; \
+                NUSE_Latency_ISR_Woken |= (U16)1 << (task); \
+            } \
+        }
+#else
+    #define NUSE_LATENCY_WAKE(task)
+#endif
+
+#if NUSE_DEADLOCK_DETECTION_SUPPORT
+
+    /* Deadlock Detection - holders of each object and the most recent cycle found */
+
+    #if NUSE_SEMAPHORE_NUMBER != 0
+        extern RAM U16 NUSE_Semaphore_Holders[NUSE_SEMAPHORE_NUMBER];                /* one bit per holding task */
+    #endif
+    #if NUSE_BINARY_SEMAPHORE_NUMBER != 0
+        extern RAM U16 NUSE_Binary_Semaphore_Holders[NUSE_BINARY_SEMAPHORE_NUMBER];  /* one bit per holding task */
+    #endif
+    #if NUSE_DEADLOCK_PARTITIONS
+        extern RAM NUSE_PARTITION_COUNT NUSE_Partition_Pool_Held[NUSE_PARTITION_POOL_NUMBER][NUSE_TASK_NUMBER];
+    #endif
+
+    extern RAM U8 NUSE_Deadlock_Length;                             /* 0 if no deadlock has been found */
+    extern RAM NUSE_TASK NUSE_Deadlock_Task[NUSE_TASK_NUMBER];
+    extern RAM U8 NUSE_Deadlock_Object[NUSE_TASK_NUMBER];
+
+    #define NUSE_DEADLOCK_HOLD(holders) \
+        { \
+            if (NUSE_Task_State == NUSE_TASK_CONTEXT) \
+            { \
+                (holders) |= (U16)1 << NUSE_Task_Active; \
+            } \
+        }
+
+    #define NUSE_DEADLOCK_DROP(holders) \
+        { \
+            if ((NUSE_Task_State == NUSE_TASK_CONTEXT) && ((holders) & ((U16)1 << NUSE_Task_Active))) \
+            { \
+                (holders) &= ~((U16)1 << NUSE_Task_Active); \
+            } \
+            else \
+            { \
+                (holders) &= (holders) - 1;         /* discharge the lowest index holder */ \
+            } \
+        }
+#else
+    #define NUSE_DEADLOCK_HOLD(holders)
+    #define NUSE_DEADLOCK_DROP(holders)
+#endif
+
+#if NUSE_WATCHDOG_SUPPORT
+
+    /* Task Watchdog - delta list of check-in deadlines */
+
+    extern RAM NUSE_TASK NUSE_Watchdog_Head;                        /* NUSE_NO_TASK if no task is watched */
+    extern RAM U16 NUSE_Watchdog_Reset_Pending;                     /* one bit per task to be reset on the next tick */
+
+    extern RAM U16 NUSE_Watchdog_Period[NUSE_TASK_NUMBER];          /* 0 if the task is not watched */
+    extern RAM U16 NUSE_Watchdog_Delta[NUSE_TASK_NUMBER];           /* ticks after the previous entry */
+    extern RAM NUSE_TASK NUSE_Watchdog_Next[NUSE_TASK_NUMBER];
+
+#endif
+
 #endif  /* ! _NUSE_DATA_H_ */
 
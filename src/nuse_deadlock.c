@@ -0,0 +1,423 @@
+/*** Deadlock detection APIs ***/
+
+/************************************************************************
+*
+*   This file contains the definitions of functions concerned with
+*   deadlock detection in Nucleus SE:
+*
+*   NUSE_Deadlock_Information()
+*
+*   The holders of each semaphore and binary semaphore [and, optionally,
+*   the partitions held by each task from each partition pool] are recorded
+*   as the objects are obtained and released
+*   Before a task blocks on one of these objects, the wait-for graph - each
+*   blocked task waits for the holders of its object - is checked by
+*   NUSE_Deadlock_Check(); if the task could never be resumed, it is not
+*   blocked, the API call returns NUSE_DEADLOCK and the cycle of tasks and
+*   objects is recorded for NUSE_Deadlock_Information()
+*
+*   Only semaphores and binary semaphores with a non-zero initial value are
+*   treated as resources; those which start at 0 are used for signalling,
+*   so have no holders
+*   A release by a task which is not a holder [or from an ISR] discharges
+*   the holder with the lowest index; likewise for a partition freed by a
+*   task which holds none from its pool
+*   The holders of a semaphore with an initial value above 1 are therefore
+*   only a guess, and a partition may have been passed on by the task which
+*   allocated it, so a cycle through either is only a possible deadlock -
+*   it is recorded, but the task is blocked as usual; a task's own
+*   partitions are not counted when it blocks on their pool
+*   Blocking in NUSE_Task_Wait_Multiple() is not checked
+*
+************************************************************************/
+
+#include "nuse_config.h"
+#include "nuse_codes.h"
+#include "nuse_types.h"
+#include "nuse_data.h"
+#include "nuse_prototypes.h"
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Deadlock_Holders()
+*
+*   DESCRIPTION
+*
+*       Returns the tasks for which a task blocked on an object is waiting
+*       - i.e. the holders of the object
+*
+*   INPUTS
+*
+*       U8 object           object index and type, encoded as for NUSE_Task_Status
+*
+*   RETURNS
+*
+*       U16 value           one bit per holding task; 0 if the object has no holders
+*                           or is not a tracked object
+*
+*   OTHER OUTPUTS
+*
+*       (none)
+*
+*************************************************************************/
+
+#if NUSE_DEADLOCK_DETECTION_SUPPORT
+
+    U16 NUSE_Deadlock_Holders(U8 object)
+    {
+        #if NUSE_DEADLOCK_PARTITIONS
+            U16 holders;
+            NUSE_TASK index;
+        #endif
+
+        switch (LONIB(object))
+        {
+            #if NUSE_SEMAPHORE_NUMBER != 0
+                case NUSE_SEMAPHORE_SUSPEND:
+                    if (NUSE_Semaphore_Initial_Value[HINIB(object)] != 0)
+                    {
+                        return NUSE_Semaphore_Holders[HINIB(object)];
+                    }
+                    break;
+            #endif
+            #if NUSE_BINARY_SEMAPHORE_NUMBER != 0
+                case NUSE_BINARY_SUSPEND:
+                    if (NUSE_Binary_Semaphore_Initial_Value[HINIB(object)])
+                    {
+                        return NUSE_Binary_Semaphore_Holders[HINIB(object)];
+                    }
+                    break;
+            #endif
+            #if NUSE_DEADLOCK_PARTITIONS
+                case NUSE_PARTITION_SUSPEND:
+                    holders = 0;
+                    for (index=0; index<NUSE_TASK_NUMBER; index++)
+                    {
+                        if (NUSE_Partition_Pool_Held[HINIB(object)][index] != 0)
+                        {
+                            holders |= (U16)1 << index;
+                        }
+                    }
+                    return holders;
+            #endif
+            default:
+                break;
+        }
+
+        return 0;
+    }
+
+#endif
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Deadlock_Check()
+*
+*   DESCRIPTION
+*
+*       Called in a critical section before the current task blocks on an object
+*       The wait-for graph is first checked without the waits on multi-unit
+*       semaphores and partition pools, and then, if the task may block, with
+*       them; a cycle found the second time is recorded, but does not prevent
+*       the task from blocking
+*
+*   INPUTS
+*
+*       U8 object           object on which the current task would block,
+*                           encoded as for NUSE_Task_Status
+*
+*   RETURNS
+*
+*       TRUE                blocking would deadlock the current task
+*       FALSE               the task may block
+*
+*   OTHER OUTPUTS
+*
+*       NUSE_Deadlock_Length, NUSE_Deadlock_Task[] and NUSE_Deadlock_Object[]
+*       record the cycle if one was found
+*
+*************************************************************************/
+
+#if NUSE_DEADLOCK_DETECTION_SUPPORT
+
+    U8 NUSE_Deadlock_Check(U8 object)
+    {
+        U16 waits[NUSE_TASK_NUMBER];
+        NUSE_TASK task;
+        U8 deadlock;
+        #if (NUSE_SEMAPHORE_NUMBER != 0) || NUSE_DEADLOCK_PARTITIONS
+            U16 possible_waits[NUSE_TASK_NUMBER];
+        #endif
+
+        NUSE_Task_Status[NUSE_Task_Active] = object;        /* as if already blocked */
+
+        for (task=0; task<NUSE_TASK_NUMBER; task++)
+        {
+            waits[task] = NUSE_Deadlock_Holders(NUSE_Task_Status[task]);
+            #if (NUSE_SEMAPHORE_NUMBER != 0) || NUSE_DEADLOCK_PARTITIONS
+                possible_waits[task] = 0;
+            #endif
+            #if NUSE_SEMAPHORE_NUMBER != 0
+                if ((LONIB(NUSE_Task_Status[task]) == NUSE_SEMAPHORE_SUSPEND)
+                    && (NUSE_Semaphore_Initial_Value[HINIB(NUSE_Task_Status[task])] > 1))
+                {                                           /* holders may be wrongly discharged */
+                    possible_waits[task] = waits[task];
+                    waits[task] = 0;
+                }
+            #endif
+            #if NUSE_DEADLOCK_PARTITIONS
+                if (LONIB(NUSE_Task_Status[task]) == NUSE_PARTITION_SUSPEND)
+                {                                           /* own partitions may have been passed on */
+                    possible_waits[task] = waits[task] & ~((U16)1 << task);
+                    waits[task] = 0;
+                }
+            #endif
+        }
+
+        deadlock = NUSE_Deadlock_Cycle(waits);
+
+        #if (NUSE_SEMAPHORE_NUMBER != 0) || NUSE_DEADLOCK_PARTITIONS
+            if (!deadlock)
+            {
+                for (task=0; task<NUSE_TASK_NUMBER; task++)
+                {
+                    waits[task] |= possible_waits[task];
+                }
+                NUSE_Deadlock_Cycle(waits);                 /* possible deadlock - recorded only */
+            }
+        #endif
+
+        NUSE_Task_Status[NUSE_Task_Active] = NUSE_READY;
+
+        return deadlock;
+    }
+
+#endif
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Deadlock_Cycle()
+*
+*   DESCRIPTION
+*
+*       Starting with every blocked task, any task for which a holder of its object
+*       is not blocked is removed, until no more can be removed; the tasks which
+*       remain can never be resumed
+*       If the current task remains, the cycle is found by following the lowest
+*       index holder from the current task, and recorded
+*
+*   INPUTS
+*
+*       U16 *waits          for each task, one bit per task for which it waits
+*
+*   RETURNS
+*
+*       TRUE                the current task is deadlocked
+*       FALSE               the current task is not deadlocked
+*
+*   OTHER OUTPUTS
+*
+*       NUSE_Deadlock_Length, NUSE_Deadlock_Task[] and NUSE_Deadlock_Object[]
+*       record the cycle if one was found
+*
+*************************************************************************/
+
+#if NUSE_DEADLOCK_DETECTION_SUPPORT
+
+    U8 NUSE_Deadlock_Cycle(U16 *waits)
+    {
+        U16 blocked, previous, visited, next;
+        NUSE_TASK task;
+        U8 length, first, index;
+
+        blocked = 0;
+        for (task=0; task<NUSE_TASK_NUMBER; task++)
+        {
+            if (waits[task] != 0)
+            {
+                blocked |= (U16)1 << task;
+            }
+        }
+
+        do
+        {
+            previous = blocked;
+            for (task=0; task<NUSE_TASK_NUMBER; task++)
+            {
+                if (waits[task] & ~blocked)                 /* a holder can still run */
+                {
+                    blocked &= ~((U16)1 << task);
+                }
+            }
+        } while (blocked != previous);
+
+        if (!(blocked & ((U16)1 << NUSE_Task_Active)))
+        {
+            return FALSE;
+        }
+
+        visited = 0;                                        /* follow holders until a task repeats */
+        length = 0;
+        task = NUSE_Task_Active;
+        while (!(visited & ((U16)1 << task)))
+        {
+            visited |= (U16)1 << task;
+            NUSE_Deadlock_Task[length] = task;
+            NUSE_Deadlock_Object[length] = NUSE_Task_Status[task];
+            length++;
+
+            next = waits[task] & blocked;
+            for (index=0; !(next & ((U16)1 << index)); index++)
+            {
+                ;
+            }
+            task = index;
+        }
+
+        for (first=0; NUSE_Deadlock_Task[first] != task; first++)
+        {
+            ;                                               /* cycle starts at the repeated task */
+        }
+        for (index=first; index<length; index++)
+        {
+            NUSE_Deadlock_Task[index - first] = NUSE_Deadlock_Task[index];
+            NUSE_Deadlock_Object[index - first] = NUSE_Deadlock_Object[index];
+        }
+        NUSE_Deadlock_Length = length - first;
+
+        return TRUE;
+    }
+
+#endif
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Deadlock_Partition_Free()
+*
+*   DESCRIPTION
+*
+*       Called in a critical section when a partition is returned to its pool
+*       The partition is discharged from the current task if it holds any from
+*       the pool; otherwise from the lowest index task which does
+*
+*   INPUTS
+*
+*       NUSE_PARTITION_POOL pool    index of pool to which the partition was returned
+*
+*   RETURNS
+*
+*       (none)
+*
+*   OTHER OUTPUTS
+*
+*       (none)
+*
+*************************************************************************/
+
+#if NUSE_DEADLOCK_PARTITIONS
+
+    void NUSE_Deadlock_Partition_Free(NUSE_PARTITION_POOL pool)
+    {
+        NUSE_TASK task;
+
+        if ((NUSE_Task_State == NUSE_TASK_CONTEXT) && (NUSE_Partition_Pool_Held[pool][NUSE_Task_Active] != 0))
+        {
+            NUSE_Partition_Pool_Held[pool][NUSE_Task_Active]--;
+            return;
+        }
+
+        for (task=0; task<NUSE_TASK_NUMBER; task++)
+        {
+            if (NUSE_Partition_Pool_Held[pool][task] != 0)
+            {
+                NUSE_Partition_Pool_Held[pool][task]--;
+                return;
+            }
+        }
+    }
+
+#endif
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Deadlock_Information()
+*
+*   DESCRIPTION
+*
+*       Returns the most recent deadlock cycle found
+*       Each task in the cycle is blocked on [or, for the first task, was
+*       prevented from blocking on] an object held by the next task; the
+*       object of the last task is held by the first
+*       A cycle through a semaphore with an initial value above 1 or a partition
+*       pool is a possible deadlock, and the first task was blocked as usual
+*
+*   INPUTS
+*
+*       U8 *length              pointer to storage for the number of tasks in the cycle
+*       NUSE_TASK *tasks        pointer to storage for up to NUSE_TASK_NUMBER task indices
+*       U8 *objects             pointer to storage for up to NUSE_TASK_NUMBER objects
+*
+*   RETURNS
+*
+*       NUSE_SUCCESS            a deadlock cycle was returned
+*       NUSE_UNAVAILABLE        no deadlock has been found
+*       NUSE_INVALID_POINTER    one or more of the pointer parameters was NULL
+*
+*   OTHER OUTPUTS
+*
+*       U8 *length              number of tasks in the cycle [value: 1-16]
+*       NUSE_TASK *tasks        index of each task in the cycle
+*       U8 *objects             object of each task, encoded as for NUSE_Task_Status
+*                               [see NUSE_WAIT_SEMAPHORE() etc. in nuse_codes.h]
+*
+*************************************************************************/
+
+#if NUSE_DEADLOCK_INFORMATION || (NUSE_INCLUDE_EVERYTHING && NUSE_DEADLOCK_DETECTION_SUPPORT)
+
+    STATUS NUSE_Deadlock_Information(U8 *length, NUSE_TASK *tasks, U8 *objects)
+    {
+        U8 index;
+
+        #if NUSE_API_PARAMETER_CHECKING
+            if ((length == NULL) || (tasks == NULL) || (objects == NULL))
+            {
+                return NUSE_INVALID_POINTER;
+            }
+        #endif
+
+        NUSE_CS_Enter();
+
+        if (NUSE_Deadlock_Length == 0)
+        {
+            NUSE_CS_Exit();
+            return NUSE_UNAVAILABLE;
+        }
+
+        *length = NUSE_Deadlock_Length;
+        for (index=0; index<NUSE_Deadlock_Length; index++)
+        {
+            tasks[index] = NUSE_Deadlock_Task[index];
+            objects[index] = NUSE_Deadlock_Object[index];
+        }
+
+        NUSE_CS_Exit();
+
+        return NUSE_SUCCESS;
+    }
+
+#endif
@@ -28,12 +28,18 @@
 *   DESCRIPTION
 *
 *       Sets [OR operation] or clears [AND operation] flags within a group
+*       After an OR operation, each blocked task whose request is now satisfied is
+*       given its retrieved events [and any consume is applied] before being made
+*       ready; tasks whose request is not satisfied stay blocked
+*       An AND operation can only clear flags, so it never wakes a task
+*       Tasks are examined in index [priority] order, so where flags are consumed
+*       the lower-numbered task takes them first
 *
 *   INPUTS
 *
-*       NUSE_EVENT_GROUP group      index of event flag group
-*       U8 event_flags              bit pattern to specify setting/clearing
-*       OPTION operation            required operation; may be: NUSE_OR or NUSE_AND
+*       NUSE_EVENT_GROUP group          index of event flag group
+*       NUSE_EVENT_FLAGS event_flags    bit pattern to specify setting/clearing
+*       OPTION operation                required operation; may be: NUSE_OR or NUSE_AND
 *
 *   RETURNS
 *
@@ -49,10 +55,8 @@
 
 #if NUSE_EVENT_GROUP_SET || (NUSE_INCLUDE_EVERYTHING && (NUSE_EVENT_GROUP_NUMBER != 0))
 
-    STATUS NUSE_Event_Group_Set(NUSE_EVENT_GROUP group, U8 event_flags, OPTION operation)
+    STATUS NUSE_Event_Group_Set(NUSE_EVENT_GROUP group, NUSE_EVENT_FLAGS event_flags, OPTION operation)
     {
-        STATUS return_value;
-
         #if NUSE_API_PARAMETER_CHECKING
             if (group >= NUSE_EVENT_GROUP_NUMBER)
             {
@@ -61,7 +65,7 @@
 
             if ((operation != NUSE_OR) && (operation != NUSE_AND))
             {
-                return_value = NUSE_INVALID_OPERATION;
+                return NUSE_INVALID_OPERATION;
             }
         #endif
 
@@ -70,37 +74,75 @@
         if (operation == NUSE_OR)
         {
             NUSE_Event_Group_Data[group] |= event_flags;
-        }
-        else  /* NUSE_AND */
-        {
-            NUSE_Event_Group_Data[group] &= event_flags;
-        }
 
-        #if NUSE_BLOCKING_ENABLE
+            #if NUSE_BLOCKING_ENABLE
 
-            while (NUSE_Event_Group_Blocking_Count[group] != 0)
-            {
-                U8 index;                                       /* check whether any tasks are blocked */
-                                                                /* on this event group */
+                #if NUSE_TASK_WAIT_MULTIPLE || NUSE_INCLUDE_EVERYTHING
+                    if (NUSE_Multiple_Blocking_Count != 0)
+                    {
+                        NUSE_Wake_Multiple((group << 4) | NUSE_EVENT_SUSPEND);
+                    }
+                #endif
 
-                for (index=0; index<NUSE_TASK_NUMBER; index++)
+                if (NUSE_Event_Group_Blocking_Count[group] != 0)
                 {
-                    if ((LONIB(NUSE_Task_Status[index]) == NUSE_EVENT_SUSPEND)
-                        && (HINIB(NUSE_Task_Status[index]) == group))
+                    U8 index, satisfied;                        /* check whether any blocked tasks */
+                    NUSE_EVENT_FLAGS temp_events;               /* are now satisfied */
+                    OPTION task_operation;
+                    #if NUSE_SCHEDULER_TYPE == NUSE_PRIORITY_SCHEDULER
+                        U8 woken = FALSE;
+                    #endif
+
+                    for (index=0; index<NUSE_TASK_NUMBER; index++)
                     {
-                        NUSE_Task_Blocking_Return[index] = NUSE_SUCCESS;
-                        NUSE_Task_Status[index] = NUSE_READY;
-                        break;
+                        if ((LONIB(NUSE_Task_Status[index]) == NUSE_EVENT_SUSPEND)
+                            && (HINIB(NUSE_Task_Status[index]) == group))
+                        {
+                            temp_events = NUSE_Event_Group_Data[group] & NUSE_Task_Event_Request[index];
+                            task_operation = NUSE_Task_Event_Operation[index];
+
+                            if ((task_operation == NUSE_OR) || (task_operation == NUSE_OR_CONSUME))
+                            {
+                                satisfied = (temp_events != 0);
+                            }
+                            else    /* NUSE_AND or NUSE_AND_CONSUME */
+                            {
+                                satisfied = (temp_events == NUSE_Task_Event_Request[index]);
+                            }
+
+                            if (satisfied)
+                            {
+                                if ((task_operation == NUSE_OR_CONSUME) || (task_operation == NUSE_AND_CONSUME))
+                                {
+                                    NUSE_Event_Group_Data[group] &= ~temp_events;
+                                }
+                                NUSE_Task_Event_Request[index] = temp_events;   /* retrieved events */
+                                NUSE_Task_Blocking_Return[index] = NUSE_SUCCESS;
+                                NUSE_TRACE(NUSE_TRACE_WAKE, index, 0);
+                                NUSE_LATENCY_WAKE(index);
+                                NUSE_Task_Status[index] = NUSE_READY;
+                                NUSE_Event_Group_Blocking_Count[group]--;
+                                #if NUSE_SCHEDULER_TYPE == NUSE_PRIORITY_SCHEDULER
+                                    woken = TRUE;
+                                #endif
+                            }
+                        }
                     }
+
+                    #if NUSE_SCHEDULER_TYPE == NUSE_PRIORITY_SCHEDULER
+                        if (woken)
+                        {
+                            NUSE_Reschedule(NUSE_NO_TASK);
+                        }
+                    #endif
                 }
-                NUSE_Event_Group_Blocking_Count[group]--;
-            }
 
-            #if NUSE_SCHEDULER_TYPE == NUSE_PRIORITY_SCHEDULER
-                NUSE_Reschedule(NUSE_NO_TASK);
             #endif
-
-        #endif
+        }
+        else  /* NUSE_AND */
+        {
+            NUSE_Event_Group_Data[group] &= event_flags;
+        }
 
         NUSE_CS_Exit();
 
@@ -123,15 +165,19 @@
 *       A bit pattern [requested_events] determines which flags are considered
 *       OR operations return success if any flags are set
 *       AND operations return success only if all the flags are set
+*       The CONSUME variants also clear the retrieved flags, in the same critical section
+*       A blocked task is only woken by NUSE_Event_Group_Set() once its request is
+*       satisfied, and receives the retrieved events from there
 *
 *   INPUTS
 *
-*       NUSE_EVENT_GROUP group      index of event flag group
-*       U8 requested_events         bit pattern specifying required flags
-*       OPTION operation            required operation; may be: NUSE_OR or NUSE_AND
-*       U8 *retrieved_events        pointer to storage for retrieved events
-*       U8 suspend                  task suspend option - must be NUSE_NO_SUSPEND or NUSE_SUSPEND
-*                                   depending upon the setting of NUSE_BLOCKING_ENABLE
+*       NUSE_EVENT_GROUP group              index of event flag group
+*       NUSE_EVENT_FLAGS requested_events   bit pattern specifying required flags
+*       OPTION operation                    required operation; may be: NUSE_OR, NUSE_OR_CONSUME,
+*                                           NUSE_AND or NUSE_AND_CONSUME
+*       NUSE_EVENT_FLAGS *retrieved_events  pointer to storage for retrieved events
+*       U8 suspend                          task suspend option - must be NUSE_NO_SUSPEND or NUSE_SUSPEND
+*                                           depending upon the setting of NUSE_BLOCKING_ENABLE
 *
 *   RETURNS
 *
@@ -139,23 +185,22 @@
 *       NUSE_NOT_PRESENT            specified operation did not retrieve events
 *                                   [none present for OR; not all present for AND]
 *       NUSE_INVALID_GROUP          specified event group index is invalid
-*       NUSE_INVALID_OPERATION      the specified operation [operation] was not NUSE_OR or NUSE_AND
-*                                   [NUSE_OR_CONSUME and NUSE_AND_CONSUME not supported by Nucleus SE]
+*       NUSE_INVALID_OPERATION      the specified operation [operation] was not valid
 *       NUSE_INVALID_POINTER        pointer to storage for retieved events [retrieved_events] is NULL
 *       NUSE_INVALID_SUSPEND        task suspend option is not set to NUSE_NO_SUSPEND or NUSE_SUSPEND
 *
 *   OTHER OUTPUTS
 *
-*       U8 *retrieved_events        successfully retrieved events
+*       NUSE_EVENT_FLAGS *retrieved_events  successfully retrieved events
 *
 *************************************************************************/
 
 #if NUSE_EVENT_GROUP_RETRIEVE || (NUSE_INCLUDE_EVERYTHING && (NUSE_EVENT_GROUP_NUMBER != 0))
 
-    STATUS NUSE_Event_Group_Retrieve(NUSE_EVENT_GROUP group, U8 requested_events, OPTION operation, U8 *retrieved_events, U8 suspend)
+    STATUS NUSE_Event_Group_Retrieve(NUSE_EVENT_GROUP group, NUSE_EVENT_FLAGS requested_events, OPTION operation, NUSE_EVENT_FLAGS *retrieved_events, U8 suspend)
     {
         STATUS return_value;
-        U8 temp_events;
+        NUSE_EVENT_FLAGS temp_events;
 
         #if NUSE_API_PARAMETER_CHECKING
             if (group >= NUSE_EVENT_GROUP_NUMBER)
@@ -168,7 +213,8 @@
                 return NUSE_INVALID_POINTER;
             }
 
-            if ((operation != NUSE_OR) && (operation != NUSE_AND))
+            if ((operation != NUSE_OR) && (operation != NUSE_OR_CONSUME)
+                && (operation != NUSE_AND) && (operation != NUSE_AND_CONSUME))
             {
                 return NUSE_INVALID_OPERATION;
             }
@@ -188,77 +234,48 @@
 
         NUSE_CS_Enter();
 
-        #if NUSE_BLOCKING_ENABLE
-            do
-            {
-                temp_events = NUSE_Event_Group_Data[group] & requested_events;
+        temp_events = NUSE_Event_Group_Data[group] & requested_events;
 
-                if (operation == NUSE_OR)
-                {
-                    if (temp_events != 0)
-                    {
-                        return_value = NUSE_SUCCESS;
-                    }
-                    else
-                    {
-                        return_value = NUSE_NOT_PRESENT;
-                    }
-                }
-                else    /* operation == NUSE_AND */
-                {
-                    if (temp_events == requested_events)
-                    {
-                        return_value = NUSE_SUCCESS;
-                    }
-                    else
-                    {
-                        return_value = NUSE_NOT_PRESENT;
-                    }
-                }
-
-                if (return_value == NUSE_SUCCESS)
-                {
-                    suspend = NUSE_NO_SUSPEND;
-                }
-                else
-                {
-                    if (suspend == NUSE_SUSPEND)          /* block task */
-                    {
-                        NUSE_Event_Group_Blocking_Count[group]++;
-                        NUSE_Suspend_Task(NUSE_Task_Active, (group << 4) | NUSE_EVENT_SUSPEND);
-                        return_value = NUSE_Task_Blocking_Return[NUSE_Task_Active];
-                        if (return_value != NUSE_SUCCESS)
-                        {
-                            suspend = NUSE_NO_SUSPEND;
-                        }
-                    }
-                }
-            } while (suspend == NUSE_SUSPEND);
-        #else
-            temp_events = NUSE_Event_Group_Data[group] & requested_events;
-
-            if (operation == NUSE_OR)
+        if ((operation == NUSE_OR) || (operation == NUSE_OR_CONSUME))
+        {
+            if (temp_events != 0)
             {
-                if (temp_events != 0)
-                {
-                    return_value = NUSE_SUCCESS;
-                }
-                else
-                {
-                    return_value = NUSE_NOT_PRESENT;
-                }
+                return_value = NUSE_SUCCESS;
             }
-            else    /* operation == NUSE_AND */
+            else
             {
-                if (temp_events == requested_events)
-                {
-                    return_value = NUSE_SUCCESS;
-                }
-                else
-                {
-                    return_value = NUSE_NOT_PRESENT;
-                }
+                return_value = NUSE_NOT_PRESENT;
+            }
+        }
+        else    /* operation == NUSE_AND or NUSE_AND_CONSUME */
+        {
+            if (temp_events == requested_events)
+            {
+                return_value = NUSE_SUCCESS;
+            }
+            else
+            {
+                return_value = NUSE_NOT_PRESENT;
+            }
+        }
+
+        if (return_value == NUSE_SUCCESS)
+        {
+            if ((operation == NUSE_OR_CONSUME) || (operation == NUSE_AND_CONSUME))
+            {
+                NUSE_Event_Group_Data[group] &= ~temp_events;
             }
+        }
+        #if NUSE_BLOCKING_ENABLE
+            else if (suspend == NUSE_SUSPEND)                   /* block task */
+            {
+                NUSE_Task_Event_Request[NUSE_Task_Active] = requested_events;
+                NUSE_Task_Event_Operation[NUSE_Task_Active] = operation;
+                NUSE_Event_Group_Blocking_Count[group]++;
+                NUSE_Suspend_Task(NUSE_Task_Active, (group << 4) | NUSE_EVENT_SUSPEND);
+                return_value = NUSE_Task_Blocking_Return[NUSE_Task_Active];
+                temp_events = NUSE_Task_Event_Request[NUSE_Task_Active];    /* retrieved [and consumed] */
+            }                                                               /* by NUSE_Event_Group_Set() */
         #endif
 
         if (return_value == NUSE_SUCCESS)
@@ -287,10 +304,10 @@
 *
 *   INPUTS
 *
-*       NUSE_EVENT_GROUP group      index of event group about which information is required
-*       U8 *event_flags             pointer to storage for the current event flags setting
-*       U8 *tasks_waiting           pointer to storage for number of waiting tasks
-*       NUSE_TASK *first_task       pointer to storage for pointer to first waiting task
+*       NUSE_EVENT_GROUP group          index of event group about which information is required
+*       NUSE_EVENT_FLAGS *event_flags   pointer to storage for the current event flags setting
+*       U8 *tasks_waiting               pointer to storage for number of waiting tasks
+*       NUSE_TASK *first_task           pointer to storage for pointer to first waiting task
 *
 *   RETURNS
 *
@@ -300,15 +317,15 @@
 *
 *   OTHER OUTPUTS
 *
-*       U8 *event_flags             current event flags setting
-*       U8 *tasks_waiting           number of waiting tasks [if used - otherwise 0]
-*       NUSE_TASK *first_task       first waiting task [if used - otherwise 0]
+*       NUSE_EVENT_FLAGS *event_flags   current event flags setting
+*       U8 *tasks_waiting               number of waiting tasks [if used - otherwise 0]
+*       NUSE_TASK *first_task           first waiting task [if used - otherwise 0]
 *
 *************************************************************************/
 
 #if NUSE_EVENT_GROUP_INFORMATION || (NUSE_INCLUDE_EVERYTHING && (NUSE_EVENT_GROUP_NUMBER != 0))
 
-    STATUS NUSE_Event_Group_Information(NUSE_EVENT_GROUP group, U8 *event_flags, U8 *tasks_waiting, NUSE_TASK *first_task)
+    STATUS NUSE_Event_Group_Information(NUSE_EVENT_GROUP group, NUSE_EVENT_FLAGS *event_flags, U8 *tasks_waiting, NUSE_TASK *first_task)
     {
         #if NUSE_API_PARAMETER_CHECKING
             if (group >= NUSE_EVENT_GROUP_NUMBER)
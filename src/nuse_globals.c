@@ -25,4 +25,35 @@ RAM NUSE_TASK NUSE_Task_Saved_State;
 
 #if NUSE_SCHEDULER_TYPE == NUSE_TIME_SLICE_SCHEDULER
     RAM U16 NUSE_Time_Slice_Ticks;
+#endif
+
+#if NUSE_TRACE_SUPPORT
+    RAM U32 NUSE_Trace_Buffer[NUSE_TRACE_SIZE];     /* ring of trace records */
+    RAM U16 NUSE_Trace_Index;                       /* total records written [wraps around] */
+#endif
+
+
+#if NUSE_RUNTIME_SUPPORT
+    RAM U32 NUSE_Run_Time_Switch;           /* cycle counter value at last context switch */
+    RAM U32 NUSE_Run_Time_Start;            /* cycle counter value when accounting started */
+#endif
+
+#if NUSE_LATENCY_SUPPORT
+    RAM U32 NUSE_Latency_ISR_Entry;         /* cycle counter value at managed ISR entry */
+    RAM U32 NUSE_Latency_Block_Time;        /* cycle counter value when the current task blocked */
+    RAM U8 NUSE_Latency_Blocking;           /* current task is blocking */
+    RAM U8 NUSE_Latency_Switch_Pending;     /* next task to resume completes a block-to-switch measurement */
+    RAM U16 NUSE_Latency_Resume_Hook;       /* bit set for each task which will resume in NUSE_Reschedule() */
+    RAM U16 NUSE_Latency_ISR_Woken;         /* bit set for each such task woken by an ISR */
+#endif
+
+#if NUSE_DEADLOCK_DETECTION_SUPPORT
+    RAM U8 NUSE_Deadlock_Length;            /* number of tasks in the most recent deadlock cycle found */
+    RAM NUSE_TASK NUSE_Deadlock_Task[NUSE_TASK_NUMBER];     /* tasks in the cycle */
+    RAM U8 NUSE_Deadlock_Object[NUSE_TASK_NUMBER];          /* object on which each task is blocked */
+#endif
+
+#if NUSE_WATCHDOG_SUPPORT
+    RAM NUSE_TASK NUSE_Watchdog_Head;       /* first task in the check-in deadline list */
+    RAM U16 NUSE_Watchdog_Reset_Pending;    /* bit set for each task to be reset on the next tick */
 #endif
\ No newline at end of file
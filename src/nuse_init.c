@@ -7,10 +7,14 @@
 *
 *   NUSE_Init_Task()
 *   NUSE_Init_Partition_Pool()
+*   NUSE_Init_Memory_Pool()
 *   NUSE_Init_Mailbox()
 *   NUSE_Init_Queue()
 *   NUSE_Init_Pipe()
+*   NUSE_Init_Channel()
+*   NUSE_Init_Board()
 *   NUSE_Init_Semaphore()
+*   NUSE_Init_Binary_Semaphore()
 *   NUSE_Init_Event_Group()
 *   NUSE_Init_Timer()
 *   NUSE_Init()
@@ -35,9 +39,11 @@
 *       Initialization of global RAM data for a task - the data arrays are also declared here
 *       This may include:
 *           Task context [for non-RTC schedulers]
+*           Stack fill pattern [if stack painting is configured]
 *           Signal flags [if configured]
 *           Timeout/sleep counter [if configured]
 *           Task status [if suspend is enabled], which may be set to NUSE_READY or a configured initial state
+*           Receive buffer pointer [if queue or pipe broadcast is configured]
 *           Schedule count [if configured]
 *
 *   INPUTS
@@ -62,6 +68,10 @@
     RAM U8 NUSE_Task_Signal_Flags[NUSE_TASK_NUMBER];
 #endif
 
+#if (NUSE_SIGNALS_WAIT || NUSE_INCLUDE_EVERYTHING) && NUSE_BLOCKING_ENABLE
+    RAM U8 NUSE_Task_Signal_Mask[NUSE_TASK_NUMBER];     /* set when a task blocks */
+#endif
+
 #if NUSE_TASK_SLEEP || NUSE_INCLUDE_EVERYTHING
     RAM U16 NUSE_Task_Timeout_Counter[NUSE_TASK_NUMBER];
 #endif
@@ -74,10 +84,41 @@
     RAM U8 NUSE_Task_Blocking_Return[NUSE_TASK_NUMBER];
 #endif
 
+#if (NUSE_QUEUE_BROADCAST || NUSE_PIPE_BROADCAST || NUSE_INCLUDE_EVERYTHING) && NUSE_BLOCKING_ENABLE
+    RAM ADDR NUSE_Task_Receive_Buffer[NUSE_TASK_NUMBER];
+#endif
+
+#if NUSE_TASK_WAIT_MULTIPLE || NUSE_INCLUDE_EVERYTHING
+    RAM U8 *NUSE_Task_Wait_List[NUSE_TASK_NUMBER];      /* set while a task is in NUSE_Task_Wait_Multiple() */
+    #if NUSE_EVENT_GROUP_NUMBER != 0
+        RAM NUSE_EVENT_FLAGS *NUSE_Task_Wait_Events[NUSE_TASK_NUMBER];
+        RAM OPTION *NUSE_Task_Wait_Operations[NUSE_TASK_NUMBER];
+    #endif
+#endif
+
+#if (NUSE_TASK_WAIT_MULTIPLE || NUSE_INCLUDE_EVERYTHING) && NUSE_BLOCKING_ENABLE
+    RAM U8 NUSE_Task_Wait_Count[NUSE_TASK_NUMBER];
+    RAM U8 NUSE_Multiple_Blocking_Count;
+#endif
+
 #if NUSE_SCHEDULE_COUNT_SUPPORT || NUSE_INCLUDE_EVERYTHING
     RAM U16 NUSE_Task_Schedule_Count[NUSE_TASK_NUMBER];
 #endif
 
+#if NUSE_RUNTIME_SUPPORT
+    RAM U32 NUSE_Task_Run_Time[NUSE_TASK_NUMBER];
+#endif
+
+#if NUSE_STACK_CHECK_SWITCH
+    RAM U16 NUSE_Task_Stack_Overflow;
+#endif
+
+#if NUSE_WATCHDOG_SUPPORT
+    RAM U16 NUSE_Watchdog_Period[NUSE_TASK_NUMBER];
+    RAM U16 NUSE_Watchdog_Delta[NUSE_TASK_NUMBER];
+    RAM NUSE_TASK NUSE_Watchdog_Next[NUSE_TASK_NUMBER];
+#endif
+
 void NUSE_Init_Task(NUSE_TASK task)
 {
     #if NUSE_SCHEDULER_TYPE != NUSE_RUN_TO_COMPLETION_SCHEDULER
@@ -89,6 +130,36 @@ void NUSE_Init_Task(NUSE_TASK task)
             (U32 *)NUSE_Task_Stack_Base[task] + NUSE_Task_Stack_Size[task];
     #endif
 
+    #if NUSE_STACK_PAINTING
+        if ((NUSE_Task_State == NUSE_STARTUP_CONTEXT) || (task != NUSE_Task_Active))
+        {                                           /* the active task's stack is in use - by the task or an ISR */
+            U16 word;
+
+            for (word=0; word<NUSE_Task_Stack_Size[task]; word++)
+            {
+                ((U32 *)NUSE_Task_Stack_Base[task])[word] = NUSE_STACK_PAINT_VALUE;
+            }
+        }
+    #endif
+
+    #if NUSE_STACK_CHECK_SWITCH
+        NUSE_Task_Stack_Overflow &= ~((U16)1 << task);
+    #endif
+
+    #if NUSE_LATENCY_SUPPORT                        /* task will start at its entry point */
+        NUSE_Latency_Resume_Hook &= ~((U16)1 << task);
+        NUSE_Latency_ISR_Woken &= ~((U16)1 << task);
+    #endif
+
+    #if NUSE_WATCHDOG_SUPPORT                       /* task starts its own watch again */
+        if ((NUSE_Task_State != NUSE_STARTUP_CONTEXT) && (NUSE_Watchdog_Period[task] != 0))
+        {
+            NUSE_Watchdog_Remove(task);
+        }
+        NUSE_Watchdog_Period[task] = 0;
+        NUSE_Watchdog_Reset_Pending &= ~((U16)1 << task);
+    #endif
+
     #if NUSE_SIGNAL_SUPPORT || NUSE_INCLUDE_EVERYTHING
         NUSE_Task_Signal_Flags[task] = 0;
     #endif
@@ -105,9 +176,17 @@ void NUSE_Init_Task(NUSE_TASK task)
         #endif
     #endif
 
+    #if (NUSE_QUEUE_BROADCAST || NUSE_PIPE_BROADCAST || NUSE_INCLUDE_EVERYTHING) && NUSE_BLOCKING_ENABLE
+        NUSE_Task_Receive_Buffer[task] = NULL;
+    #endif
+
     #if NUSE_SCHEDULE_COUNT_SUPPORT || NUSE_INCLUDE_EVERYTHING
         NUSE_Task_Schedule_Count[task] = 0;
     #endif
+
+    #if NUSE_RUNTIME_SUPPORT
+        NUSE_Task_Run_Time[task] = 0;
+    #endif
 }
 
 
@@ -121,6 +200,7 @@ void NUSE_Init_Task(NUSE_TASK task)
 *
 *       Initialization of global RAM data for any partition pools  - the data arrays are also declared here
 *       Sets the status of the pool to indicate that no partitionas are in use
+*       and links all of the partitions into the free list, in address order
 *
 *   INPUTS
 *
@@ -138,7 +218,16 @@ void NUSE_Init_Task(NUSE_TASK task)
 
 #if NUSE_PARTITION_POOL_NUMBER != 0
 
-    RAM U8 NUSE_Partition_Pool_Partition_Used[NUSE_PARTITION_POOL_NUMBER];
+    RAM NUSE_PARTITION_COUNT NUSE_Partition_Pool_Partition_Used[NUSE_PARTITION_POOL_NUMBER];
+    RAM NUSE_PARTITION_COUNT NUSE_Partition_Pool_Free_Head[NUSE_PARTITION_POOL_NUMBER];
+
+    #if NUSE_PARTITION_ALLOCATE_SIZE || NUSE_INCLUDE_EVERYTHING
+
+        RAM U16 NUSE_Partition_Pool_Hits[NUSE_PARTITION_POOL_NUMBER];
+        RAM U16 NUSE_Partition_Pool_Fallbacks[NUSE_PARTITION_POOL_NUMBER];
+        RAM U16 NUSE_Partition_Pool_Failures[NUSE_PARTITION_POOL_NUMBER];
+
+    #endif
 
     #if NUSE_BLOCKING_ENABLE
 
@@ -146,15 +235,123 @@ void NUSE_Init_Task(NUSE_TASK task)
 
     #endif
 
+    #if NUSE_DEADLOCK_PARTITIONS
+
+        RAM NUSE_PARTITION_COUNT NUSE_Partition_Pool_Held[NUSE_PARTITION_POOL_NUMBER][NUSE_TASK_NUMBER];
+
+    #endif
+
     void NUSE_Init_Partition_Pool(NUSE_PARTITION_POOL pool)
     {
+        NUSE_PARTITION_COUNT slot;
+        #if NUSE_DEADLOCK_PARTITIONS
+            NUSE_TASK task;
+        #endif
+
         NUSE_Partition_Pool_Partition_Used[pool] = 0;
 
+        for (slot=0; slot<NUSE_Partition_Pool_Partition_Number[pool]; slot++)
+        {
+            NUSE_Partition_Pool_Free_List[pool][slot] = slot + 1;    /* last entry is end of list */
+        }
+        NUSE_Partition_Pool_Free_Head[pool] = 0;
+
+        #if NUSE_PARTITION_ALLOCATE_SIZE || NUSE_INCLUDE_EVERYTHING
+
+            NUSE_Partition_Pool_Hits[pool] = 0;
+            NUSE_Partition_Pool_Fallbacks[pool] = 0;
+            NUSE_Partition_Pool_Failures[pool] = 0;
+
+        #endif
+
         #if NUSE_BLOCKING_ENABLE
 
             NUSE_Partition_Pool_Blocking_Count[pool] = 0;
 
         #endif
+
+        #if NUSE_DEADLOCK_PARTITIONS
+
+            for (task=0; task<NUSE_TASK_NUMBER; task++)
+            {
+                NUSE_Partition_Pool_Held[pool][task] = 0;
+            }
+
+        #endif
+    }
+
+#endif
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Init_Memory_Pool()
+*
+*   DESCRIPTION
+*
+*       Initialization of global RAM data for any memory pools  - the data arrays are also declared here
+*       The whole pool is set up as a single free block, unless it is too small or not aligned
+*
+*   INPUTS
+*
+*       NUSE_MEMORY_POOL pool         index of the pool to be initialized
+*
+*   RETURNS
+*
+*       (none)
+*
+*   OTHER OUTPUTS
+*
+*       (none)
+*
+*************************************************************************/
+
+#if NUSE_MEMORY_POOL_NUMBER != 0
+
+    RAM U16 NUSE_Memory_Pool_Free_Head[NUSE_MEMORY_POOL_NUMBER][NUSE_MEMORY_FL_COUNT * NUSE_MEMORY_SL_COUNT];
+    RAM U16 NUSE_Memory_Pool_FL_Map[NUSE_MEMORY_POOL_NUMBER];
+    RAM U8 NUSE_Memory_Pool_SL_Map[NUSE_MEMORY_POOL_NUMBER][NUSE_MEMORY_FL_COUNT];
+    RAM U16 NUSE_Memory_Pool_Available[NUSE_MEMORY_POOL_NUMBER];
+
+    #if NUSE_BLOCKING_ENABLE
+
+        RAM U8 NUSE_Memory_Pool_Blocking_Count[NUSE_MEMORY_POOL_NUMBER];
+
+    #endif
+
+    void NUSE_Init_Memory_Pool(NUSE_MEMORY_POOL pool)
+    {
+        U8 index;
+
+        for (index=0; index<NUSE_MEMORY_FL_COUNT * NUSE_MEMORY_SL_COUNT; index++)
+        {
+            NUSE_Memory_Pool_Free_Head[pool][index] = NUSE_MEMORY_NONE;
+        }
+        for (index=0; index<NUSE_MEMORY_FL_COUNT; index++)
+        {
+            NUSE_Memory_Pool_SL_Map[pool][index] = 0;
+        }
+        NUSE_Memory_Pool_FL_Map[pool] = 0;
+
+        if (NUSE_MEMORY_VALID(pool))
+        {
+            NUSE_MEMORY_BLOCK(pool, 0)[0] = NUSE_MEMORY_END(pool);
+            NUSE_MEMORY_BLOCK(pool, 0)[1] = 0;
+            NUSE_Memory_Insert(pool, 0);
+            NUSE_Memory_Pool_Available[pool] = NUSE_MEMORY_END(pool);
+        }
+        else
+        {
+            NUSE_Memory_Pool_Available[pool] = 0;           /* misconfigured - left empty */
+        }
+
+        #if NUSE_BLOCKING_ENABLE
+
+            NUSE_Memory_Pool_Blocking_Count[pool] = 0;
+
+        #endif
     }
 
 #endif
@@ -319,6 +516,103 @@ void NUSE_Init_Task(NUSE_TASK task)
 #endif
 
 
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Init_Channel()
+*
+*   DESCRIPTION
+*
+*       Initialization of global RAM data for any channels  - the data arrays are also declared here
+*       Head and tail pointers [indices] are initialized to the start of the data area
+*       There is no items count - the channel is empty when head and tail are equal
+*
+*   INPUTS
+*
+*       NUSE_CHANNEL channel  index of the channel to be initialized
+*
+*   RETURNS
+*
+*       (none)
+*
+*   OTHER OUTPUTS
+*
+*       (none)
+*
+*************************************************************************/
+
+#if NUSE_CHANNEL_NUMBER != 0
+
+    RAM volatile U8 NUSE_Channel_Head[NUSE_CHANNEL_NUMBER];
+    RAM volatile U8 NUSE_Channel_Tail[NUSE_CHANNEL_NUMBER];
+
+    #if NUSE_BLOCKING_ENABLE
+
+        RAM volatile NUSE_TASK NUSE_Channel_Waiter[NUSE_CHANNEL_NUMBER];
+
+    #endif
+
+    void NUSE_Init_Channel(NUSE_CHANNEL channel)
+    {
+        NUSE_Channel_Head[channel] = 0;
+        NUSE_Channel_Tail[channel] = 0;
+
+        #if NUSE_BLOCKING_ENABLE
+
+            NUSE_Channel_Waiter[channel] = NUSE_NO_TASK;
+
+        #endif
+    }
+
+#endif
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Init_Board()
+*
+*   DESCRIPTION
+*
+*       Initialization of global RAM data for any state boards  - the data arrays are also declared here
+*       The sequence number is set to zero, which makes the first copy of the record current
+*       That copy is cleared, so a read before the first write returns zeroes
+*
+*   INPUTS
+*
+*       NUSE_BOARD board      index of the state board to be initialized
+*
+*   RETURNS
+*
+*       (none)
+*
+*   OTHER OUTPUTS
+*
+*       (none)
+*
+*************************************************************************/
+
+#if NUSE_BOARD_NUMBER != 0
+
+    RAM volatile U16 NUSE_Board_Sequence[NUSE_BOARD_NUMBER];
+
+    void NUSE_Init_Board(NUSE_BOARD board)
+    {
+        U8 i;
+
+        NUSE_Board_Sequence[board] = 0;
+
+        for (i=0; i<NUSE_Board_Size[board]; i++)
+        {
+            NUSE_Board_Data[board][i] = 0;
+        }
+    }
+
+#endif
+
+
 /*************************************************************************
 *
 *   FUNCTION
@@ -346,7 +640,7 @@ void NUSE_Init_Task(NUSE_TASK task)
 
 #if NUSE_SEMAPHORE_NUMBER != 0
 
-    RAM U8 NUSE_Semaphore_Counter[NUSE_SEMAPHORE_NUMBER];
+    RAM NUSE_SEMAPHORE_COUNTER NUSE_Semaphore_Counter[NUSE_SEMAPHORE_NUMBER];
 
     #if NUSE_BLOCKING_ENABLE
 
@@ -354,6 +648,12 @@ void NUSE_Init_Task(NUSE_TASK task)
 
     #endif
 
+    #if NUSE_DEADLOCK_DETECTION_SUPPORT
+
+        RAM U16 NUSE_Semaphore_Holders[NUSE_SEMAPHORE_NUMBER];
+
+    #endif
+
     void NUSE_Init_Semaphore(NUSE_SEMAPHORE semaphore)
     {
         NUSE_Semaphore_Counter[semaphore] = NUSE_Semaphore_Initial_Value[semaphore];
@@ -363,6 +663,80 @@ void NUSE_Init_Task(NUSE_TASK task)
             NUSE_Semaphore_Blocking_Count[semaphore] = 0;
 
         #endif
+
+        #if NUSE_DEADLOCK_DETECTION_SUPPORT
+
+            NUSE_Semaphore_Holders[semaphore] = 0;
+
+        #endif
+    }
+
+#endif
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Init_Binary_Semaphore()
+*
+*   DESCRIPTION
+*
+*       Initialization of global RAM data for any binary semaphores  - the data arrays are also declared here
+*       State bit is set if the semaphore is initially available
+*
+*   INPUTS
+*
+*       NUSE_BINARY_SEMAPHORE semaphore   index of the binary semaphore to be initialized
+*
+*   RETURNS
+*
+*       (none)
+*
+*   OTHER OUTPUTS
+*
+*       (none)
+*
+*************************************************************************/
+
+#if NUSE_BINARY_SEMAPHORE_NUMBER != 0
+
+    RAM U16 NUSE_Binary_Semaphore_State;
+
+    #if NUSE_BLOCKING_ENABLE
+
+        RAM U16 NUSE_Binary_Semaphore_Waiters[NUSE_BINARY_SEMAPHORE_NUMBER];
+
+    #endif
+
+    #if NUSE_DEADLOCK_DETECTION_SUPPORT
+
+        RAM U16 NUSE_Binary_Semaphore_Holders[NUSE_BINARY_SEMAPHORE_NUMBER];
+
+    #endif
+
+    void NUSE_Init_Binary_Semaphore(NUSE_BINARY_SEMAPHORE semaphore)
+    {
+        if (NUSE_Binary_Semaphore_Initial_Value[semaphore])
+        {
+            NUSE_Binary_Semaphore_State |= (U16)1 << semaphore;
+        }
+        else
+        {
+            NUSE_Binary_Semaphore_State &= ~((U16)1 << semaphore);
+        }
+
+        #if NUSE_BLOCKING_ENABLE
+
+            NUSE_Binary_Semaphore_Waiters[semaphore] = 0;
+
+        #endif
+
+        #if NUSE_DEADLOCK_DETECTION_SUPPORT
+
+            NUSE_Binary_Semaphore_Holders[semaphore] = 0;
+
+        #endif
     }
 
 #endif
@@ -378,6 +752,8 @@ void NUSE_Init_Task(NUSE_TASK task)
 *
 *       Initialization of global RAM data for any event groups  - the data arrays are also declared here
 *       Event flags are all cleared
+*       The per-task request and operation arrays need no initialization - they are
+*       set when a task blocks on an event group
 *
 *   INPUTS
 *
@@ -395,11 +771,13 @@ void NUSE_Init_Task(NUSE_TASK task)
 
 #if NUSE_EVENT_GROUP_NUMBER != 0
 
-    RAM U8 NUSE_Event_Group_Data[NUSE_EVENT_GROUP_NUMBER];
+    RAM NUSE_EVENT_FLAGS NUSE_Event_Group_Data[NUSE_EVENT_GROUP_NUMBER];
 
     #if NUSE_BLOCKING_ENABLE
 
         RAM U8 NUSE_Event_Group_Blocking_Count[NUSE_EVENT_GROUP_NUMBER];
+        RAM NUSE_EVENT_FLAGS NUSE_Task_Event_Request[NUSE_TASK_NUMBER];
+        RAM OPTION NUSE_Task_Event_Operation[NUSE_TASK_NUMBER];
 
     #endif
 
@@ -458,6 +836,175 @@ void NUSE_Init_Task(NUSE_TASK task)
 #endif
 
 
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Init_Wait_Statistics()
+*
+*   DESCRIPTION
+*
+*       Initialization of the blocking and wait time statistics - the data arrays are also declared here
+*       All counts and times are set to 0, as are the queue and pipe peak occupancy values
+*
+*   INPUTS
+*
+*       (none)
+*
+*   RETURNS
+*
+*       (none)
+*
+*   OTHER OUTPUTS
+*
+*       (none)
+*
+*************************************************************************/
+
+#if NUSE_WAIT_STATISTICS_SUPPORT
+
+    RAM U16 NUSE_Wait_Blocks[NUSE_WAIT_STATISTICS_NUMBER];
+    RAM U8 NUSE_Wait_Max_Waiters[NUSE_WAIT_STATISTICS_NUMBER];
+    RAM U32 NUSE_Wait_Total_Time[NUSE_WAIT_STATISTICS_NUMBER];
+    RAM U32 NUSE_Wait_Max_Time[NUSE_WAIT_STATISTICS_NUMBER];
+
+    #if NUSE_QUEUE_NUMBER != 0
+        RAM U8 NUSE_Queue_Peak[NUSE_QUEUE_NUMBER];
+    #endif
+
+    #if NUSE_PIPE_NUMBER != 0
+        RAM U8 NUSE_Pipe_Peak[NUSE_PIPE_NUMBER];
+    #endif
+
+    void NUSE_Init_Wait_Statistics(void)
+    {
+        U8 index;
+
+        for (index=0; index<NUSE_WAIT_STATISTICS_NUMBER; index++)
+        {
+            NUSE_Wait_Blocks[index] = 0;
+            NUSE_Wait_Max_Waiters[index] = 0;
+            NUSE_Wait_Total_Time[index] = 0;
+            NUSE_Wait_Max_Time[index] = 0;
+        }
+
+        #if NUSE_QUEUE_NUMBER != 0
+            for (index=0; index<NUSE_QUEUE_NUMBER; index++)
+            {
+                NUSE_Queue_Peak[index] = NUSE_Queue_Items[index];
+            }
+        #endif
+
+        #if NUSE_PIPE_NUMBER != 0
+            for (index=0; index<NUSE_PIPE_NUMBER; index++)
+            {
+                NUSE_Pipe_Peak[index] = NUSE_Pipe_Items[index];
+            }
+        #endif
+    }
+
+#endif
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Init_CS_Profile()
+*
+*   DESCRIPTION
+*
+*       Initialization of the critical section profile - the data arrays are also declared here
+*       The histogram and worst case are cleared and all exit point entries are released
+*
+*   INPUTS
+*
+*       (none)
+*
+*   RETURNS
+*
+*       (none)
+*
+*   OTHER OUTPUTS
+*
+*       (none)
+*
+*************************************************************************/
+
+#if NUSE_CS_PROFILE_SUPPORT
+
+    RAM U32 NUSE_CS_Start;
+    RAM U32 NUSE_CS_Histogram[NUSE_HISTOGRAM_BUCKETS];
+    RAM U32 NUSE_CS_Worst;
+    RAM U8 NUSE_CS_Sites_Used;
+    RAM char *NUSE_CS_Site_File[NUSE_CS_PROFILE_SITES];
+    RAM U16 NUSE_CS_Site_Line[NUSE_CS_PROFILE_SITES];
+    RAM U16 NUSE_CS_Site_Count[NUSE_CS_PROFILE_SITES];
+    RAM U32 NUSE_CS_Site_Worst[NUSE_CS_PROFILE_SITES];
+
+    void NUSE_Init_CS_Profile(void)
+    {
+        U8 index;
+
+        for (index=0; index<NUSE_HISTOGRAM_BUCKETS; index++)
+        {
+            NUSE_CS_Histogram[index] = 0;
+        }
+        NUSE_CS_Worst = 0;
+        NUSE_CS_Sites_Used = 0;                 /* entries are set up as exit points are seen */
+    }
+
+#endif
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Init_Latency()
+*
+*   DESCRIPTION
+*
+*       Initialization of the latency histograms - the data arrays are also declared here
+*       The histograms and worst case values are cleared; the measurement state
+*       [in nuse_globals.c] is initialized by NUSE_Init()
+*
+*   INPUTS
+*
+*       (none)
+*
+*   RETURNS
+*
+*       (none)
+*
+*   OTHER OUTPUTS
+*
+*       (none)
+*
+*************************************************************************/
+
+#if NUSE_LATENCY_SUPPORT
+
+    RAM U32 NUSE_Task_Wake_Time[NUSE_TASK_NUMBER];
+    RAM U32 NUSE_Latency_Counts[2][NUSE_HISTOGRAM_BUCKETS];
+    RAM U32 NUSE_Latency_Worst[2];
+
+    void NUSE_Init_Latency(void)
+    {
+        U8 bucket;
+
+        for (bucket=0; bucket<NUSE_HISTOGRAM_BUCKETS; bucket++)
+        {
+            NUSE_Latency_Counts[NUSE_INTERRUPT_LATENCY][bucket] = 0;
+            NUSE_Latency_Counts[NUSE_SWITCH_LATENCY][bucket] = 0;
+        }
+        NUSE_Latency_Worst[NUSE_INTERRUPT_LATENCY] = 0;
+        NUSE_Latency_Worst[NUSE_SWITCH_LATENCY] = 0;
+    }
+
+#endif
+
+
 /*************************************************************************
 *
 *   FUNCTION
@@ -497,13 +1044,41 @@ void NUSE_Init(void)
         NUSE_Tick_Clock = 0;
     #endif
 
+    #if NUSE_TRACE_SUPPORT
+        for (NUSE_Trace_Index=0; NUSE_Trace_Index<NUSE_TRACE_SIZE; NUSE_Trace_Index++)
+        {
+            NUSE_Trace_Buffer[NUSE_Trace_Index] = 0;        /* mark all records unused */
+        }
+        NUSE_Trace_Index = 0;
+    #endif
+
+    #if NUSE_RUNTIME_SUPPORT
+        NUSE_Run_Time_Start = NUSE_Run_Time_Switch = NUSE_CYCLE_COUNTER();
+    #endif
+
+    #if NUSE_LATENCY_SUPPORT
+        NUSE_Latency_Blocking = FALSE;
+        NUSE_Latency_Switch_Pending = FALSE;
+        NUSE_Latency_Resume_Hook = 0;
+        NUSE_Latency_ISR_Woken = 0;
+    #endif
+
+    #if NUSE_WATCHDOG_SUPPORT
+        NUSE_Watchdog_Head = NUSE_NO_TASK;
+        NUSE_Watchdog_Reset_Pending = 0;
+    #endif
+
     #if NUSE_SCHEDULER_TYPE == NUSE_TIME_SLICE_SCHEDULER
         NUSE_Time_Slice_Ticks = NUSE_TIME_SLICE_TICKS;
     #endif
 
+    #if (NUSE_TASK_WAIT_MULTIPLE || NUSE_INCLUDE_EVERYTHING) && NUSE_BLOCKING_ENABLE
+        NUSE_Multiple_Blocking_Count = 0;
+    #endif
+
     /* tasks */
 
-    #if ((NUSE_SCHEDULER_TYPE != NUSE_RUN_TO_COMPLETION_SCHEDULER) || NUSE_SIGNAL_SUPPORT || NUSE_TASK_SLEEP || NUSE_SUSPEND_ENABLE || NUSE_SCHEDULE_COUNT_SUPPORT)
+    #if ((NUSE_SCHEDULER_TYPE != NUSE_RUN_TO_COMPLETION_SCHEDULER) || NUSE_SIGNAL_SUPPORT || NUSE_TASK_SLEEP || NUSE_SUSPEND_ENABLE || NUSE_SCHEDULE_COUNT_SUPPORT || NUSE_RUNTIME_SUPPORT || NUSE_LATENCY_SUPPORT)
         for (index=0; index<NUSE_TASK_NUMBER; index++)
         {
                 NUSE_Init_Task(index);
@@ -519,6 +1094,15 @@ void NUSE_Init(void)
         }
     #endif
 
+    /* memory pools */
+
+    #if NUSE_MEMORY_POOL_NUMBER != 0
+        for (index=0; index<NUSE_MEMORY_POOL_NUMBER; index++)
+        {
+            NUSE_Init_Memory_Pool(index);
+        }
+    #endif
+
     /* mailboxes */
 
     #if NUSE_MAILBOX_NUMBER != 0
@@ -546,6 +1130,24 @@ void NUSE_Init(void)
         }
     #endif
 
+    /* channels */
+
+    #if NUSE_CHANNEL_NUMBER != 0
+        for (index=0; index<NUSE_CHANNEL_NUMBER; index++)
+        {
+            NUSE_Init_Channel(index);
+        }
+    #endif
+
+    /* state boards */
+
+    #if NUSE_BOARD_NUMBER != 0
+        for (index=0; index<NUSE_BOARD_NUMBER; index++)
+        {
+            NUSE_Init_Board(index);
+        }
+    #endif
+
     /* semaphores */
 
     #if NUSE_SEMAPHORE_NUMBER != 0
@@ -555,6 +1157,13 @@ void NUSE_Init(void)
         }
     #endif
 
+    #if NUSE_BINARY_SEMAPHORE_NUMBER != 0
+        for (index=0; index<NUSE_BINARY_SEMAPHORE_NUMBER; index++)
+        {
+            NUSE_Init_Binary_Semaphore(index);
+        }
+    #endif
+
     /* event groups */
 
     #if NUSE_EVENT_GROUP_NUMBER != 0
@@ -572,4 +1181,24 @@ void NUSE_Init(void)
             NUSE_Init_Timer(index);
         }
     #endif
+
+    /* statistics */
+
+    #if NUSE_WAIT_STATISTICS_SUPPORT
+        NUSE_Init_Wait_Statistics();
+    #endif
+
+    #if NUSE_CS_PROFILE_SUPPORT
+        NUSE_Init_CS_Profile();
+    #endif
+
+    #if NUSE_LATENCY_SUPPORT
+        NUSE_Init_Latency();
+    #endif
+
+    /* deadlock detection */
+
+    #if NUSE_DEADLOCK_DETECTION_SUPPORT
+        NUSE_Deadlock_Length = 0;
+    #endif
 }
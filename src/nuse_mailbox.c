@@ -6,6 +6,7 @@
 *   handling of mailboxes in Nucleus SE:
 *
 *   NUSE_Mailbox_Send()
+*   NUSE_Mailbox_Overwrite()
 *   NUSE_Mailbox_Receive()
 *   NUSE_Mailbox_Reset()
 *   NUSE_Mailbox_Information()
@@ -91,6 +92,12 @@
                 {
                     NUSE_Mailbox_Data[mailbox] = *message;
                     NUSE_Mailbox_Status[mailbox] = TRUE;
+                    #if NUSE_TASK_WAIT_MULTIPLE || NUSE_INCLUDE_EVERYTHING
+                        if (NUSE_Multiple_Blocking_Count != 0)
+                        {
+                            NUSE_Wake_Multiple((mailbox << 4) | NUSE_MAILBOX_SUSPEND);
+                        }
+                    #endif
                     if (NUSE_Mailbox_Blocking_Count[mailbox] != 0)
                     {
                         U8 index;                       /* check whether a task is blocked */
@@ -148,6 +155,98 @@
 #endif
 
 
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Mailbox_Overwrite()
+*
+*   DESCRIPTION
+*
+*       Sends a single (type ADDR) message, replacing any message already in the mailbox
+*       Always succeeds, so a receiver sees the latest value and the sender never stalls
+*       If the mailbox was empty and a task is blocked on receive, it is woken
+*       Never blocks, so may be called from an ISR; if blocking is enabled,
+*       that must be a managed ISR, as a receiver may need to be woken
+*
+*   INPUTS
+*
+*       NUSE_MAILBOX mailbox    index of mailbox to be used
+*       ADDR *message           pointer to message to be sent
+*
+*   RETURNS
+*
+*       NUSE_SUCCESS            message successfully sent
+*       NUSE_INVALID_MAILBOX    specified mailbox index is invalid
+*       NUSE_INVALID_POINTER    message pointer [message] is NULL
+*
+*   OTHER OUTPUTS
+*
+*       (none)
+*
+*************************************************************************/
+
+
+#if NUSE_MAILBOX_OVERWRITE || (NUSE_INCLUDE_EVERYTHING && (NUSE_MAILBOX_NUMBER != 0))
+
+    STATUS NUSE_Mailbox_Overwrite(NUSE_MAILBOX mailbox, ADDR *message)
+    {
+        #if NUSE_BLOCKING_ENABLE
+            U8 was_full;
+        #endif
+
+        #if NUSE_API_PARAMETER_CHECKING
+            if (mailbox >= NUSE_MAILBOX_NUMBER)
+            {
+                return NUSE_INVALID_MAILBOX;
+            }
+
+            if (message == NULL)
+            {
+                return NUSE_INVALID_POINTER;
+            }
+        #endif
+
+        NUSE_CS_Enter();
+
+        #if NUSE_BLOCKING_ENABLE
+            was_full = NUSE_Mailbox_Status[mailbox];    /* receivers only wait on an empty mailbox */
+        #endif
+        NUSE_Mailbox_Data[mailbox] = *message;
+        NUSE_Mailbox_Status[mailbox] = TRUE;
+
+        #if NUSE_BLOCKING_ENABLE
+            #if NUSE_TASK_WAIT_MULTIPLE || NUSE_INCLUDE_EVERYTHING
+                if (!was_full && (NUSE_Multiple_Blocking_Count != 0))
+                {
+                    NUSE_Wake_Multiple((mailbox << 4) | NUSE_MAILBOX_SUSPEND);
+                }
+            #endif
+            if (!was_full && (NUSE_Mailbox_Blocking_Count[mailbox] != 0))
+            {
+                U8 index;                       /* mailbox was empty, so any blocked */
+                                                /* task is waiting to receive */
+                NUSE_Mailbox_Blocking_Count[mailbox]--;
+                for (index=0; index<NUSE_TASK_NUMBER; index++)
+                {
+                    if ((LONIB(NUSE_Task_Status[index]) == NUSE_MAILBOX_SUSPEND)
+                        && (HINIB(NUSE_Task_Status[index]) == mailbox))
+                    {
+                        NUSE_Task_Blocking_Return[index] = NUSE_SUCCESS;
+                        NUSE_Wake_Task(index);
+                        break;
+                    }
+                }
+            }
+        #endif
+
+        NUSE_CS_Exit();
+        return NUSE_SUCCESS;
+    }
+
+#endif
+
+
 /*************************************************************************
 *
 *   FUNCTION
@@ -332,6 +431,8 @@
                         && (HINIB(NUSE_Task_Status[index]) == mailbox))
                     {
                         NUSE_Task_Blocking_Return[index] = NUSE_MAILBOX_WAS_RESET;
+                        NUSE_TRACE(NUSE_TRACE_WAKE, index, 0);
+                        NUSE_LATENCY_WAKE(index);
                         NUSE_Task_Status[index] = NUSE_READY;
                         break;
                     }
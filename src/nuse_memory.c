@@ -0,0 +1,651 @@
+/*** Memory pool handling APIs ***/
+
+/************************************************************************
+*
+*   This file contains the definitions of functions concerned with the
+*   handling of memory pools in Nucleus SE:
+*
+*   NUSE_Memory_Allocate()
+*   NUSE_Memory_Deallocate()
+*   NUSE_Memory_Pool_Information()
+*   NUSE_Memory_Pool_Count()
+*
+*   A memory pool supplies blocks of any size, using a two level segregated
+*   fit scheme: free blocks are kept on lists by size class - a first level
+*   for each power of 2 and four second level divisions of each - and a bit
+*   map of the non-empty lists means that a suitable block is found without
+*   searching, so allocation and deallocation take a bounded time
+*   Each block has a 4 byte header holding its size and the size of the block
+*   before it in memory, so that adjacent free blocks are merged on deallocation
+*   Offsets from the start of the pool [type U16] are used for links, so a pool
+*   may be up to 64K bytes
+*
+************************************************************************/
+
+#include "nuse_config.h"
+#include "nuse_codes.h"
+#include "nuse_types.h"
+#include "nuse_data.h"
+#include "nuse_prototypes.h"
+
+
+#if NUSE_MEMORY_ALLOCATE || (NUSE_INCLUDE_EVERYTHING && (NUSE_MEMORY_POOL_NUMBER != 0))
+
+    /* index of the lowest set bit in a non-zero bit map */
+
+    static U8 Memory_Lowest_Bit(U16 map)
+    {
+        U8 bit;
+
+        for (bit=0; !(map & 1); bit++)
+        {
+            map >>= 1;
+        }
+
+        return bit;
+    }
+
+#endif
+
+#if NUSE_MEMORY_POOL_NUMBER != 0
+
+    /* first and second level list indices for a block size */
+
+    static void Memory_Mapping(U16 size, U8 *fl, U8 *sl)
+    {
+        U8 bit;
+
+        if (size < 16)
+        {
+            *fl = 0;
+            *sl = size >> 2;
+        }
+        else
+        {
+            bit = 4;
+            while ((size >> bit) > 1)               /* find most significant bit */
+            {
+                bit++;
+            }
+            *fl = bit - 3;
+            *sl = (size >> (bit - 2)) & 3;
+        }
+    }
+
+#endif
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Memory_Allocate()
+*
+*   DESCRIPTION
+*
+*       Allocates a block of memory of at least the specified size from the specified pool
+*       The request is rounded up to the next list boundary, so the first block on
+*       the first non-empty list at or above that boundary is always large enough;
+*       any excess is split off and returned to the pool
+*       If the boundary is beyond the end of the pool, the list for the request
+*       itself is also tried; it can hold only one block, so only that is checked
+*
+*   INPUTS
+*
+*       NUSE_MEMORY_POOL pool       index of pool from which allocation is required
+*       ADDR *return_pointer        pointer to location for memory address
+*       U16 size                    number of bytes required
+*       U8 suspend                  task suspend option - must be NUSE_NO_SUSPEND or NUSE_SUSPEND
+*                                   depending upon the setting of NUSE_BLOCKING_ENABLE
+*
+*   RETURNS
+*
+*       NUSE_SUCCESS                memory successfully allocated
+*       NUSE_NO_MEMORY              no block large enough is available
+*       NUSE_INVALID_POOL           specified pool index is invalid, or the pool is misconfigured
+*       NUSE_INVALID_POINTER        data return pointer [return_pointer] is NULL
+*       NUSE_INVALID_SIZE           size is 0 or larger than the pool
+*       NUSE_INVALID_SUSPEND        task suspend option is not set to NUSE_NO_SUSPEND or NUSE_SUSPEND
+*
+*   OTHER OUTPUTS
+*
+*       ADDR *return_pointer        pointer to allocated memory [aligned to 4 bytes]
+*
+*************************************************************************/
+
+#if NUSE_MEMORY_ALLOCATE || (NUSE_INCLUDE_EVERYTHING && (NUSE_MEMORY_POOL_NUMBER != 0))
+
+    STATUS NUSE_Memory_Allocate(NUSE_MEMORY_POOL pool, ADDR *return_pointer, U16 size, U8 suspend)
+    {
+        STATUS return_value;
+        U32 need, search;
+        U16 offset, rest, next;
+        U16 *block;
+        U8 fl, sl, map, bit, exact;
+
+        #if NUSE_API_PARAMETER_CHECKING
+            if ((pool >= NUSE_MEMORY_POOL_NUMBER) || !NUSE_MEMORY_VALID(pool))
+            {
+                return NUSE_INVALID_POOL;
+            }
+
+            if (return_pointer == NULL)
+            {
+                return NUSE_INVALID_POINTER;
+            }
+
+            #if NUSE_BLOCKING_ENABLE
+                if ((suspend != NUSE_NO_SUSPEND) && (suspend != NUSE_SUSPEND))
+                {
+                    return NUSE_INVALID_SUSPEND;
+                }
+            #else
+                if (suspend != NUSE_NO_SUSPEND)
+                {
+                    return NUSE_INVALID_SUSPEND;
+                }
+            #endif
+        #endif
+
+        need = ((U32)size + NUSE_MEMORY_HEADER + 3) & ~3;           /* block size, including header */
+        if (need < NUSE_MEMORY_MINIMUM)
+        {
+            need = NUSE_MEMORY_MINIMUM;
+        }
+
+        if ((size == 0) || (need > NUSE_MEMORY_END(pool)))
+        {
+            return NUSE_INVALID_SIZE;
+        }
+
+        search = need;                                              /* round up to a list boundary */
+        if (search >= 16)
+        {
+            bit = 4;
+            while ((search >> bit) > 1)
+            {
+                bit++;
+            }
+            search += ((U32)1 << (bit - 2)) - 1;
+        }
+        exact = (search > NUSE_MEMORY_END(pool));                   /* boundary may be beyond any block */
+        if (exact)
+        {
+            search = need;
+        }
+
+        NUSE_CS_Enter();
+
+        do
+        {
+            offset = NUSE_MEMORY_NONE;
+
+            Memory_Mapping((U16)search, &fl, &sl);
+
+            if (exact)
+            {                                                       /* the one block in the list may fit */
+                next = NUSE_Memory_Pool_Free_Head[pool][fl * NUSE_MEMORY_SL_COUNT + sl];
+                if ((next != NUSE_MEMORY_NONE) && ((NUSE_MEMORY_BLOCK(pool, next)[0] & ~NUSE_MEMORY_FREE) >= need))
+                {
+                    offset = next;
+                }
+                sl++;                                               /* otherwise only larger lists */
+            }
+
+            if (offset == NUSE_MEMORY_NONE)
+            {
+                map = (sl < NUSE_MEMORY_SL_COUNT) ? NUSE_Memory_Pool_SL_Map[pool][fl] & (0xff << sl) : 0;
+                if (map == 0)
+                {                                                   /* try a larger first level class */
+                    if (NUSE_Memory_Pool_FL_Map[pool] & (U16)(0xffff << (fl + 1)))
+                    {
+                        fl = Memory_Lowest_Bit(NUSE_Memory_Pool_FL_Map[pool] & (U16)(0xffff << (fl + 1)));
+                        map = NUSE_Memory_Pool_SL_Map[pool][fl];
+                    }
+                }
+
+                if (map != 0)
+                {
+                    sl = Memory_Lowest_Bit(map);
+                    offset = NUSE_Memory_Pool_Free_Head[pool][fl * NUSE_MEMORY_SL_COUNT + sl];
+                }
+            }
+
+            if (offset != NUSE_MEMORY_NONE)
+            {
+                NUSE_Memory_Remove(pool, offset);
+                block = NUSE_MEMORY_BLOCK(pool, offset);
+
+                if (block[0] - need >= NUSE_MEMORY_MINIMUM)         /* split off the excess */
+                {
+                    rest = offset + (U16)need;
+                    NUSE_MEMORY_BLOCK(pool, rest)[0] = block[0] - (U16)need;
+                    NUSE_MEMORY_BLOCK(pool, rest)[1] = (U16)need;
+                    next = offset + block[0];
+                    if (next < NUSE_MEMORY_END(pool))
+                    {
+                        NUSE_MEMORY_BLOCK(pool, next)[1] = block[0] - (U16)need;
+                    }
+                    block[0] = (U16)need;
+                    NUSE_Memory_Insert(pool, rest);
+                }
+
+                NUSE_Memory_Pool_Available[pool] -= block[0];
+                *return_pointer = (U8 *)block + NUSE_MEMORY_HEADER;
+                return_value = NUSE_SUCCESS;
+                suspend = NUSE_NO_SUSPEND;
+            }
+            else
+            {
+                return_value = NUSE_NO_MEMORY;
+
+                #if NUSE_BLOCKING_ENABLE
+                    if (suspend == NUSE_SUSPEND)
+                    {                                               /* block task */
+                        NUSE_Memory_Pool_Blocking_Count[pool]++;
+                        NUSE_Suspend_Task(NUSE_Task_Active, (pool << 4) | NUSE_MEMORY_SUSPEND);
+                        return_value = NUSE_Task_Blocking_Return[NUSE_Task_Active];
+                        if (return_value != NUSE_SUCCESS)
+                        {
+                            suspend = NUSE_NO_SUSPEND;
+                        }
+                    }
+                #else
+                    suspend = NUSE_NO_SUSPEND;
+                #endif
+            }
+        } while (suspend == NUSE_SUSPEND);
+
+        NUSE_CS_Exit();
+
+        return return_value;
+    }
+
+#endif
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Memory_Deallocate()
+*
+*   DESCRIPTION
+*
+*       Frees the block of memory pointed to by the supplied pointer
+*       The block is merged with the blocks either side of it, if they are free,
+*       before being returned to the appropriate list
+*       Any tasks blocked on the pool are woken to retry their allocation
+*
+*   INPUTS
+*
+*       ADDR memory         pointer to [address of] memory to be deallocated
+*
+*   RETURNS
+*
+*       NUSE_SUCCESS            memory was successfully deallocated
+*       NUSE_INVALID_POINTER    supplied pointer is NULL or does not appear to point to an allocated block
+*
+*   OTHER OUTPUTS
+*
+*       (none)
+*
+*************************************************************************/
+
+#if NUSE_MEMORY_DEALLOCATE || (NUSE_INCLUDE_EVERYTHING && (NUSE_MEMORY_POOL_NUMBER != 0))
+
+    STATUS NUSE_Memory_Deallocate(ADDR memory)
+    {
+        U8 pool;
+        U16 offset, size, next, prev;
+        U16 *block;
+
+        #if NUSE_API_PARAMETER_CHECKING
+            if (memory == NULL)
+            {
+                return NUSE_INVALID_POINTER;
+            }
+        #endif
+
+        for (pool=0; pool<NUSE_MEMORY_POOL_NUMBER; pool++)          /* find the pool which contains it */
+        {
+            if (((U8 *)memory >= (U8 *)NUSE_Memory_Pool_Data_Address[pool] + NUSE_MEMORY_HEADER)
+                && ((U8 *)memory < (U8 *)NUSE_Memory_Pool_Data_Address[pool] + NUSE_MEMORY_END(pool)))
+            {
+                break;
+            }
+        }
+
+        if (pool == NUSE_MEMORY_POOL_NUMBER)
+        {
+            return NUSE_INVALID_POINTER;
+        }
+
+        offset = (U8 *)memory - (U8 *)NUSE_Memory_Pool_Data_Address[pool] - NUSE_MEMORY_HEADER;
+        block = NUSE_MEMORY_BLOCK(pool, offset);
+
+        NUSE_CS_Enter();
+
+        if ((offset & 3) || (block[0] & NUSE_MEMORY_FREE) || (block[0] < NUSE_MEMORY_MINIMUM)
+            || ((U32)offset + block[0] > NUSE_MEMORY_END(pool)))
+        {
+            NUSE_CS_Exit();
+            return NUSE_INVALID_POINTER;                            /* not an allocated block */
+        }
+
+        size = block[0];
+        block[0] |= NUSE_MEMORY_FREE;                               /* catch a second free of this address */
+        NUSE_Memory_Pool_Available[pool] += size;
+
+        next = offset + size;                                       /* merge with following block */
+        if ((next < NUSE_MEMORY_END(pool)) && (NUSE_MEMORY_BLOCK(pool, next)[0] & NUSE_MEMORY_FREE))
+        {
+            NUSE_Memory_Remove(pool, next);
+            size += NUSE_MEMORY_BLOCK(pool, next)[0];
+        }
+
+        if (block[1] != 0)                                          /* merge with preceding block */
+        {
+            prev = offset - block[1];
+            if (NUSE_MEMORY_BLOCK(pool, prev)[0] & NUSE_MEMORY_FREE)
+            {
+                NUSE_Memory_Remove(pool, prev);
+                size += NUSE_MEMORY_BLOCK(pool, prev)[0];
+                offset = prev;
+            }
+        }
+
+        NUSE_MEMORY_BLOCK(pool, offset)[0] = size;
+        next = offset + size;
+        if (next < NUSE_MEMORY_END(pool))
+        {
+            NUSE_MEMORY_BLOCK(pool, next)[1] = size;
+        }
+        NUSE_Memory_Insert(pool, offset);
+
+        #if NUSE_BLOCKING_ENABLE
+
+            if (NUSE_Memory_Pool_Blocking_Count[pool] != 0)
+            {
+                U8 index;                           /* wake all tasks blocked on this pool */
+                                                    /* each one retries its allocation */
+                for (index=0; index<NUSE_TASK_NUMBER; index++)
+                {
+                    if ((LONIB(NUSE_Task_Status[index]) == NUSE_MEMORY_SUSPEND)
+                        && (HINIB(NUSE_Task_Status[index]) == pool))
+                    {
+                        NUSE_Task_Blocking_Return[index] = NUSE_SUCCESS;
+                        NUSE_TRACE(NUSE_TRACE_WAKE, index, 0);
+                        NUSE_LATENCY_WAKE(index);
+                        NUSE_Task_Status[index] = NUSE_READY;
+                    }
+                }
+                NUSE_Memory_Pool_Blocking_Count[pool] = 0;
+
+                #if NUSE_SCHEDULER_TYPE == NUSE_PRIORITY_SCHEDULER
+                    NUSE_Reschedule(NUSE_NO_TASK);
+                #endif
+            }
+
+        #endif
+
+        NUSE_CS_Exit();
+
+        return NUSE_SUCCESS;
+    }
+
+#endif
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Memory_Pool_Information()
+*
+*   DESCRIPTION
+*
+*       Returns a number of items of data about a memory pool
+*       Unsupported items are handled in nuse.h
+*
+*   INPUTS
+*
+*       NUSE_MEMORY_POOL pool       index of pool about which information is required
+*       ADDR *start_address         pointer to storage for pool start address
+*       U16 *pool_size              pointer to storage for size of pool
+*       U16 *min_allocation         pointer to storage for minimum allocation size
+*       U16 *available              pointer to storage for number of bytes available
+*       U8 *tasks_waiting           pointer to storage for number of waiting tasks [only used if blocking enable]
+*       NUSE_TASK *first_task       pointer to storage for pointer to first waiting task [only used if blocking enable]
+*
+*   RETURNS
+*
+*       NUSE_SUCCESS                the pool status was successfully returned
+*       NUSE_INVALID_POOL           the pool index was not valid
+*       NUSE_INVALID_POINTER        one or more of the pointer parameters was NULL
+*
+*   OTHER OUTPUTS
+*
+*       ADDR *start_address         pool start address
+*       U16 *pool_size              size of pool [in bytes]
+*       U16 *min_allocation         minimum allocation size [in bytes]
+*       U16 *available              number of bytes available [including block headers]
+*       U8 *tasks_waiting           number of waiting tasks [if used, otherwise 0]
+*       NUSE_TASK *first_task       first waiting task [if used, otherwise 0]
+*
+*************************************************************************/
+
+#if NUSE_MEMORY_POOL_INFORMATION || (NUSE_INCLUDE_EVERYTHING && (NUSE_MEMORY_POOL_NUMBER != 0))
+
+    STATUS NUSE_Memory_Pool_Information(NUSE_MEMORY_POOL pool, ADDR *start_address, U16 *pool_size, U16 *min_allocation, U16 *available, U8 *tasks_waiting, NUSE_TASK *first_task)
+    {
+        #if NUSE_API_PARAMETER_CHECKING
+            if (pool >= NUSE_MEMORY_POOL_NUMBER)
+            {
+                return NUSE_INVALID_POOL;
+            }
+
+            if ((start_address == NULL) || (pool_size == NULL) || (min_allocation == NULL) || (available == NULL) || (tasks_waiting == NULL) || (first_task == NULL))
+            {
+                return NUSE_INVALID_POINTER;
+            }
+        #endif
+
+        NUSE_CS_Enter();
+
+        *start_address = NUSE_Memory_Pool_Data_Address[pool];
+        *pool_size = NUSE_Memory_Pool_Size[pool];
+        *min_allocation = NUSE_MEMORY_MINIMUM - NUSE_MEMORY_HEADER;
+        *available = NUSE_Memory_Pool_Available[pool];
+
+        #if NUSE_BLOCKING_ENABLE
+
+            *tasks_waiting = NUSE_Memory_Pool_Blocking_Count[pool];
+            if (NUSE_Memory_Pool_Blocking_Count[pool] != 0)
+            {
+                U8 index;
+
+                for (index=0; index<NUSE_TASK_NUMBER; index++)
+                {
+                    if ((LONIB(NUSE_Task_Status[index]) == NUSE_MEMORY_SUSPEND)
+                        && (HINIB(NUSE_Task_Status[index]) == pool))
+                    {
+                        *first_task = index;
+                        break;
+                    }
+                }
+            }
+            else
+            {
+                *first_task = 0;
+            }
+
+        #else
+
+            *tasks_waiting = 0;
+            *first_task = 0;
+
+        #endif
+
+        NUSE_CS_Exit();
+
+        return NUSE_SUCCESS;
+    }
+
+#endif
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Memory_Pool_Count()
+*
+*   DESCRIPTION
+*
+*       Returns the number of memory pools in the system
+*       Code is trivial, as the number of memory pools is fixed in Nucleus SE,
+*       so a constant is returned
+*
+*   INPUTS
+*
+*       (none)
+*
+*   RETURNS
+*
+*       U8 value        number of memory pools in the system [Value: 0-15]
+*
+*   OTHER OUTPUTS
+*
+*       (none)
+*
+*************************************************************************/
+
+#if NUSE_MEMORY_POOL_COUNT || NUSE_INCLUDE_EVERYTHING
+
+    U8 NUSE_Memory_Pool_Count(void)
+    {
+        return NUSE_MEMORY_POOL_NUMBER;
+    }
+
+#endif
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Memory_Insert()
+*
+*   DESCRIPTION
+*
+*       Marks a block free and adds it to the head of the list for its size class
+*       Must be called in a critical section [or during initialization]
+*
+*   INPUTS
+*
+*       NUSE_MEMORY_POOL pool       index of pool containing the block
+*       U16 offset                  offset of the block from the start of the pool
+*
+*   RETURNS
+*
+*       (none)
+*
+*   OTHER OUTPUTS
+*
+*       (none)
+*
+*************************************************************************/
+
+#if NUSE_MEMORY_POOL_NUMBER != 0
+
+    void NUSE_Memory_Insert(NUSE_MEMORY_POOL pool, U16 offset)
+    {
+        U16 *block;
+        U16 *head;
+        U8 fl, sl;
+
+        block = NUSE_MEMORY_BLOCK(pool, offset);
+        Memory_Mapping(block[0] & ~NUSE_MEMORY_FREE, &fl, &sl);
+        head = &NUSE_Memory_Pool_Free_Head[pool][fl * NUSE_MEMORY_SL_COUNT + sl];
+
+        block[0] |= NUSE_MEMORY_FREE;
+        block[2] = *head;
+        block[3] = NUSE_MEMORY_NONE;
+        if (*head != NUSE_MEMORY_NONE)
+        {
+            NUSE_MEMORY_BLOCK(pool, *head)[3] = offset;
+        }
+        *head = offset;
+
+        NUSE_Memory_Pool_FL_Map[pool] |= 1 << fl;
+        NUSE_Memory_Pool_SL_Map[pool][fl] |= 1 << sl;
+    }
+
+#endif
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Memory_Remove()
+*
+*   DESCRIPTION
+*
+*       Takes a free block off the list for its size class and marks it used
+*       Must be called in a critical section
+*
+*   INPUTS
+*
+*       NUSE_MEMORY_POOL pool       index of pool containing the block
+*       U16 offset                  offset of the block from the start of the pool
+*
+*   RETURNS
+*
+*       (none)
+*
+*   OTHER OUTPUTS
+*
+*       (none)
+*
+*************************************************************************/
+
+#if NUSE_MEMORY_ALLOCATE || NUSE_MEMORY_DEALLOCATE || (NUSE_INCLUDE_EVERYTHING && (NUSE_MEMORY_POOL_NUMBER != 0))
+
+    void NUSE_Memory_Remove(NUSE_MEMORY_POOL pool, U16 offset)
+    {
+        U16 *block;
+        U16 *head;
+        U8 fl, sl;
+
+        block = NUSE_MEMORY_BLOCK(pool, offset);
+        Memory_Mapping(block[0] & ~NUSE_MEMORY_FREE, &fl, &sl);
+        head = &NUSE_Memory_Pool_Free_Head[pool][fl * NUSE_MEMORY_SL_COUNT + sl];
+
+        if (block[3] != NUSE_MEMORY_NONE)
+        {
+            NUSE_MEMORY_BLOCK(pool, block[3])[2] = block[2];
+        }
+        else
+        {
+            *head = block[2];
+        }
+        if (block[2] != NUSE_MEMORY_NONE)
+        {
+            NUSE_MEMORY_BLOCK(pool, block[2])[3] = block[3];
+        }
+
+        if (*head == NUSE_MEMORY_NONE)                              /* list now empty */
+        {
+            NUSE_Memory_Pool_SL_Map[pool][fl] &= ~(1 << sl);
+            if (NUSE_Memory_Pool_SL_Map[pool][fl] == 0)
+            {
+                NUSE_Memory_Pool_FL_Map[pool] &= ~(1 << fl);
+            }
+        }
+
+        block[0] &= ~NUSE_MEMORY_FREE;
+    }
+
+#endif
@@ -6,10 +6,26 @@
 *   handling of partition pools in Nucleus SE:
 *
 *   NUSE_Partition_Allocate()
+*   NUSE_Partition_Allocate_Size()
 *   NUSE_Partition_Deallocate()
+*   NUSE_Partition_Reference()
+*   NUSE_Partition_Send()
 *   NUSE_Partition_Pool_Information()
+*   NUSE_Partition_Pool_Statistics()
 *   NUSE_Partition_Pool_Count()
 *
+*   If NUSE_PARTITION_ALIGNMENT is 0, each partition is preceded by a status
+*   byte, which holds the pool index; otherwise, partitions are placed at
+*   multiples of the alignment from the start of the pool, with no status
+*   byte, and the pool is found from the partition address
+*
+*   While a partition is allocated, its free list entry holds
+*   NUSE_PARTITION_IN_USE, which is above the number of partitions in the
+*   pool, so it cannot be mistaken for a free list link
+*   If NUSE_Partition_Reference() or NUSE_Partition_Send() is used, the number
+*   of further references to each allocated partition is held in the pool's
+*   reference count array; the partition is freed when it is 0 on deallocation
+*
 ************************************************************************/
 
 #include "nuse_config.h"
@@ -18,6 +34,15 @@
 #include "nuse_data.h"
 #include "nuse_prototypes.h"
 
+/* distance between the starts of adjacent partitions in a pool */
+
+#if NUSE_PARTITION_ALIGNMENT == 0
+    #define NUSE_PARTITION_STRIDE(pool) (NUSE_Partition_Pool_Partition_Size[pool] + 1)
+#else
+    #define NUSE_PARTITION_STRIDE(pool) \
+        ((NUSE_Partition_Pool_Partition_Size[pool] + NUSE_PARTITION_ALIGNMENT - 1) & ~(NUSE_PARTITION_ALIGNMENT - 1))
+#endif
+
 
 /*************************************************************************
 *
@@ -28,6 +53,8 @@
 *   DESCRIPTION
 *
 *       Allocates a partition within the specified pool
+*       The partition is taken from the head of the pool's free list, so the
+*       time taken does not depend upon how many partitions are in use
 *
 *   INPUTS
 *
@@ -55,7 +82,6 @@
     STATUS NUSE_Partition_Allocate(NUSE_PARTITION_POOL pool, ADDR *return_pointer, U8 suspend)
     {
         STATUS return_value;
-        U8 *ptr;
 
         #if NUSE_API_PARAMETER_CHECKING
             if (pool >= NUSE_PARTITION_POOL_NUMBER)
@@ -94,6 +120,9 @@
                     }
                     else
                     {                                           /* block task */
+                        #if NUSE_DEADLOCK_PARTITIONS              /* possible deadlock is only recorded */
+                            NUSE_Deadlock_Check((pool << 4) | NUSE_PARTITION_SUSPEND);
+                        #endif
                         NUSE_Partition_Pool_Blocking_Count[pool]++;
                         NUSE_Suspend_Task(NUSE_Task_Active, (pool << 4) | NUSE_PARTITION_SUSPEND);
                         return_value = NUSE_Task_Blocking_Return[NUSE_Task_Active];
@@ -105,15 +134,7 @@
                 }
                 else
                 {
-                    ptr = (U8 *)NUSE_Partition_Pool_Data_Address[pool];         /* point to status byte of 1st partition */
-                    while ( *ptr != 0)                                          /* find an unused partition */
-                    {
-                        ptr += NUSE_Partition_Pool_Partition_Size[pool] + 1;
-                    }
-                    *ptr = 0x80 | pool;                                         /* mark used */
-                                                                                /* need pool number for deallocation */
-                    NUSE_Partition_Pool_Partition_Used[pool]++;
-                    *return_pointer = ptr + 1;
+                    *return_pointer = NUSE_Partition_Take(pool);
                     return_value = NUSE_SUCCESS;
                     suspend = NUSE_NO_SUSPEND;
                 }
@@ -125,15 +146,7 @@
             }
             else
             {
-                ptr = (U8 *)NUSE_Partition_Pool_Data_Address[pool];         /* point to status byte of 1st partition */
-                while ( *ptr != 0)                                          /* find an unused partition */
-                {
-                    ptr += NUSE_Partition_Pool_Partition_Size[pool] + 1;
-                }
-                *ptr = 0x80 | pool;                                         /* mark used */
-                                                                            /* need pool number for deallocation */
-                NUSE_Partition_Pool_Partition_Used[pool]++;
-                *return_pointer = ptr + 1;
+                *return_pointer = NUSE_Partition_Take(pool);
                 return_value = NUSE_SUCCESS;
             }
         #endif
@@ -146,6 +159,110 @@
 #endif
 
 
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Partition_Allocate_Size()
+*
+*   DESCRIPTION
+*
+*       Allocates a partition of at least the specified size
+*       The pool with the smallest partitions which are large enough is used;
+*       if it has no free partitions, the next larger pool with a free partition
+*       is used instead
+*       Each allocation is counted against the pool used, as a hit or a fallback,
+*       or as a failure against the smallest pool that would have fitted
+*       Never blocks, as the request may be satisfied by more than one pool
+*
+*   INPUTS
+*
+*       U16 size                    required partition size [in bytes]
+*       ADDR *return_pointer        pointer to location for partition address
+*
+*   RETURNS
+*
+*       NUSE_SUCCESS                partition successfully allocated
+*       NUSE_NO_PARTITION           no partition large enough is available
+*       NUSE_INVALID_SIZE           no pool has partitions large enough
+*       NUSE_INVALID_POINTER        data return pointer [return_pointer] is NULL
+*
+*   OTHER OUTPUTS
+*
+*       ADDR *return_pointer        pointer to allocated partition data area
+*
+*************************************************************************/
+
+#if NUSE_PARTITION_ALLOCATE_SIZE || (NUSE_INCLUDE_EVERYTHING && (NUSE_PARTITION_POOL_NUMBER != 0))
+
+    STATUS NUSE_Partition_Allocate_Size(U16 size, ADDR *return_pointer)
+    {
+        STATUS return_value;
+        U8 pool, fit, best;
+
+        #if NUSE_API_PARAMETER_CHECKING
+            if (return_pointer == NULL)
+            {
+                return NUSE_INVALID_POINTER;
+            }
+        #endif
+
+        fit = NUSE_PARTITION_POOL_NUMBER;               /* smallest pool large enough */
+        best = NUSE_PARTITION_POOL_NUMBER;              /* smallest pool large enough with a free partition */
+
+        NUSE_CS_Enter();
+
+        for (pool=0; pool<NUSE_PARTITION_POOL_NUMBER; pool++)
+        {
+            if (NUSE_Partition_Pool_Partition_Size[pool] >= size)
+            {
+                if ((fit == NUSE_PARTITION_POOL_NUMBER)
+                    || (NUSE_Partition_Pool_Partition_Size[pool] < NUSE_Partition_Pool_Partition_Size[fit]))
+                {
+                    fit = pool;
+                }
+
+                if ((NUSE_Partition_Pool_Partition_Number[pool] != NUSE_Partition_Pool_Partition_Used[pool])
+                    && ((best == NUSE_PARTITION_POOL_NUMBER)
+                        || (NUSE_Partition_Pool_Partition_Size[pool] < NUSE_Partition_Pool_Partition_Size[best])))
+                {
+                    best = pool;
+                }
+            }
+        }
+
+        if (fit == NUSE_PARTITION_POOL_NUMBER)
+        {
+            return_value = NUSE_INVALID_SIZE;
+        }
+        else if (best == NUSE_PARTITION_POOL_NUMBER)
+        {
+            NUSE_Partition_Pool_Failures[fit]++;
+            return_value = NUSE_NO_PARTITION;           /* no free partitions */
+        }
+        else
+        {
+            if (NUSE_Partition_Pool_Partition_Size[best] == NUSE_Partition_Pool_Partition_Size[fit])
+            {
+                NUSE_Partition_Pool_Hits[best]++;
+            }
+            else
+            {
+                NUSE_Partition_Pool_Fallbacks[best]++;
+            }
+
+            *return_pointer = NUSE_Partition_Take(best);
+            return_value = NUSE_SUCCESS;
+        }
+
+        NUSE_CS_Exit();
+
+        return return_value;
+    }
+
+#endif
+
+
 /*************************************************************************
 *
 *   FUNCTION
@@ -154,7 +271,10 @@
 *
 *   DESCRIPTION
 *
-*       Frees the partition pointed to by the supplied pointer
+*       Drops a reference to the partition pointed to by the supplied pointer
+*       When the last reference is dropped, the partition is returned to the head of
+*       its pool's free list; its entry in the list must be marked as in use, so a
+*       partition cannot be freed twice
 *
 *   INPUTS
 *
@@ -176,6 +296,7 @@
     STATUS NUSE_Partition_Deallocate(ADDR partition)
     {
         U8 pool;
+        NUSE_PARTITION_COUNT slot;
         STATUS return_value;
 
         #if NUSE_API_PARAMETER_CHECKING
@@ -187,12 +308,29 @@
 
         NUSE_CS_Enter();
 
-        if ((*((U8*)partition-1) & 0xf0) == 0x80)       /* check it is a used partition */
+        return_value = NUSE_Partition_Locate(partition, &pool, &slot);
+
+        if (return_value == NUSE_SUCCESS)
         {
-            pool = *((U8*)partition-1) & 0x0f;              /* extract pool index number */
-            *((U8*)partition-1) = 0;                        /* mark unused */
+            #if NUSE_PARTITION_REFERENCE || NUSE_PARTITION_SEND || NUSE_INCLUDE_EVERYTHING
+                if (NUSE_Partition_Pool_References[pool][slot] != 0)
+                {
+                    NUSE_Partition_Pool_References[pool][slot]--;   /* drop a reference - others remain */
+                    NUSE_CS_Exit();
+                    return NUSE_SUCCESS;
+                }
+            #endif
+
+            #if NUSE_PARTITION_ALIGNMENT == 0
+                *((U8 *)partition - 1) = 0;                 /* mark unused */
+            #endif
+            NUSE_Partition_Pool_Free_List[pool][slot] = NUSE_Partition_Pool_Free_Head[pool];
+            NUSE_Partition_Pool_Free_Head[pool] = slot;     /* return to free list */
             NUSE_Partition_Pool_Partition_Used[pool]--;     /* decrement count */
-            return_value = NUSE_SUCCESS;
+
+            #if NUSE_DEADLOCK_PARTITIONS
+                NUSE_Deadlock_Partition_Free(pool);
+            #endif
 
             #if NUSE_BLOCKING_ENABLE
 
@@ -216,9 +354,73 @@
 
             #endif
         }
-        else
+
+        NUSE_CS_Exit();
+
+        return return_value;
+    }
+
+#endif
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Partition_Reference()
+*
+*   DESCRIPTION
+*
+*       Adds a reference to an allocated partition, so that it may be shared
+*       between tasks without copying
+*       Each holder of a reference calls NUSE_Partition_Deallocate() when it has
+*       finished with the partition; it is only freed when the last reference is dropped
+*
+*   INPUTS
+*
+*       ADDR partition          pointer to [address of] partition
+*
+*   RETURNS
+*
+*       NUSE_SUCCESS            reference successfully added
+*       NUSE_INVALID_POINTER    supplied pointer is NULL or does not appear to point to an allocated partition
+*       NUSE_UNAVAILABLE        partition already has the maximum number of references
+*
+*   OTHER OUTPUTS
+*
+*       (none)
+*
+*************************************************************************/
+
+#if NUSE_PARTITION_REFERENCE || (NUSE_INCLUDE_EVERYTHING && (NUSE_PARTITION_POOL_NUMBER != 0))
+
+    STATUS NUSE_Partition_Reference(ADDR partition)
+    {
+        U8 pool;
+        NUSE_PARTITION_COUNT slot;
+        STATUS return_value;
+
+        #if NUSE_API_PARAMETER_CHECKING
+            if (partition == NULL)
+            {
+                return NUSE_INVALID_POINTER;
+            }
+        #endif
+
+        NUSE_CS_Enter();
+
+        return_value = NUSE_Partition_Locate(partition, &pool, &slot);
+
+        if (return_value == NUSE_SUCCESS)
         {
-            return_value = NUSE_INVALID_POINTER;
+            if (NUSE_Partition_Pool_References[pool][slot] == 0xff)
+            {
+                return_value = NUSE_UNAVAILABLE;            /* count would overflow */
+            }
+            else
+            {
+                NUSE_Partition_Pool_References[pool][slot]++;
+            }
         }
 
         NUSE_CS_Exit();
@@ -229,6 +431,105 @@
 #endif
 
 
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Partition_Send()
+*
+*   DESCRIPTION
+*
+*       Sends a partition to each of a list of queues, adding a reference for each
+*       queue to which it is sent
+*       The reference is added before the partition is sent, so a receiving task may
+*       deallocate it at once; if a send fails, that reference is dropped again
+*       The caller keeps its own reference, which it must deallocate in the usual way
+*       Never blocks, so that a full queue does not hold up the other receivers
+*
+*   INPUTS
+*
+*       ADDR partition          pointer to [address of] partition to be sent
+*       NUSE_QUEUE *queues      pointer to array of indices of queues to be used
+*       U8 count                number of entries in [queues]
+*       U8 *sent                pointer to storage for the number of queues sent to
+*
+*   RETURNS
+*
+*       NUSE_SUCCESS            partition successfully sent to every queue
+*       NUSE_QUEUE_FULL         one or more sends failed as there was no room in the queue
+*       NUSE_INVALID_QUEUE      one or more queue indices were invalid
+*       NUSE_INVALID_POINTER    one or more of the pointer parameters was NULL, or [partition]
+*                               does not appear to point to an allocated partition
+*       NUSE_UNAVAILABLE        partition already has the maximum number of references
+*
+*   OTHER OUTPUTS
+*
+*       U8 *sent                number of queues to which the partition was sent
+*
+*************************************************************************/
+
+#if NUSE_PARTITION_SEND || (NUSE_INCLUDE_EVERYTHING && (NUSE_PARTITION_POOL_NUMBER != 0) && (NUSE_QUEUE_NUMBER != 0))
+
+    STATUS NUSE_Partition_Send(ADDR partition, NUSE_QUEUE *queues, U8 count, U8 *sent)
+    {
+        U8 pool, index;
+        NUSE_PARTITION_COUNT slot;
+        STATUS status, return_value;
+
+        #if NUSE_API_PARAMETER_CHECKING
+            if ((partition == NULL) || (queues == NULL) || (sent == NULL))
+            {
+                return NUSE_INVALID_POINTER;
+            }
+        #endif
+
+        *sent = 0;
+        return_value = NUSE_SUCCESS;
+
+        for (index=0; index<count; index++)
+        {
+            NUSE_CS_Enter();
+
+            status = NUSE_Partition_Locate(partition, &pool, &slot);
+            if (status == NUSE_SUCCESS)
+            {
+                if (NUSE_Partition_Pool_References[pool][slot] == 0xff)
+                {
+                    status = NUSE_UNAVAILABLE;
+                }
+                else
+                {
+                    NUSE_Partition_Pool_References[pool][slot]++;   /* reference for this queue */
+                }
+            }
+
+            NUSE_CS_Exit();
+
+            if (status != NUSE_SUCCESS)
+            {
+                return status;
+            }
+
+            status = NUSE_Queue_Send(queues[index], &partition, NUSE_NO_SUSPEND);
+            if (status == NUSE_SUCCESS)
+            {
+                (*sent)++;
+            }
+            else
+            {                                               /* caller's reference keeps it allocated */
+                NUSE_CS_Enter();
+                NUSE_Partition_Pool_References[pool][slot]--;
+                NUSE_CS_Exit();
+                return_value = status;
+            }
+        }
+
+        return return_value;
+    }
+
+#endif
+
+
 /*************************************************************************
 *
 *   FUNCTION
@@ -246,8 +547,8 @@
 *       ADDR *start_address         pointer to storage for pool start address
 *       U32 *pool_size              pointer to storage for size of pool
 *       U16 *partition_size         pointer to storage for size of partition
-*       U8 *available               pointer to storage for number of available partitions
-*       U8 *allocated               pointer to storage for number of partitions in use
+*       NUSE_PARTITION_COUNT *available     pointer to storage for number of available partitions
+*       NUSE_PARTITION_COUNT *allocated     pointer to storage for number of partitions in use
 *       U8 *tasks_waiting           pointer to storage for number of waiting tasks [not used]
 *       NUSE_TASK *first_task       pointer to storage for pointer to first waiting task [not used]
 *
@@ -262,8 +563,8 @@
 *       ADDR *start_address         pool start address
 *       U32 *pool_size              size of pool [in bytes]
 *       U16 *partition_size         size of partition [in bytes]
-*       U8 *available               number of available partitions
-*       U8 *allocated               number of partitions in use
+*       NUSE_PARTITION_COUNT *available     number of available partitions
+*       NUSE_PARTITION_COUNT *allocated     number of partitions in use
 *       U8 *tasks_waiting           number of waiting tasks  [if used, otherwise 0]
 *       NUSE_TASK *first_task       first waiting task  [if used, otherwise 0]
 *
@@ -271,7 +572,7 @@
 
 #if NUSE_PARTITION_POOL_INFORMATION || (NUSE_INCLUDE_EVERYTHING && (NUSE_PARTITION_POOL_NUMBER != 0))
 
-    STATUS NUSE_Partition_Pool_Information(NUSE_PARTITION_POOL pool, ADDR *start_address, U32 *pool_size, U16 *partition_size, U8 *available, U8 *allocated, U8 *tasks_waiting, NUSE_TASK *first_task)
+    STATUS NUSE_Partition_Pool_Information(NUSE_PARTITION_POOL pool, ADDR *start_address, U32 *pool_size, U16 *partition_size, NUSE_PARTITION_COUNT *available, NUSE_PARTITION_COUNT *allocated, U8 *tasks_waiting, NUSE_TASK *first_task)
     {
         #if NUSE_API_PARAMETER_CHECKING
             if (pool >= NUSE_PARTITION_POOL_NUMBER)
@@ -288,7 +589,7 @@
         NUSE_CS_Enter();
 
         *start_address = NUSE_Partition_Pool_Data_Address[pool];
-        *pool_size = NUSE_Partition_Pool_Partition_Number[pool] * NUSE_Partition_Pool_Partition_Size[pool];
+        *pool_size = (U32)NUSE_Partition_Pool_Partition_Number[pool] * NUSE_Partition_Pool_Partition_Size[pool];
         *partition_size = NUSE_Partition_Pool_Partition_Size[pool];
         *available = NUSE_Partition_Pool_Partition_Number[pool] - NUSE_Partition_Pool_Partition_Used[pool];
         *allocated = NUSE_Partition_Pool_Partition_Used[pool];
@@ -330,6 +631,68 @@
 #endif
 
 
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Partition_Pool_Statistics()
+*
+*   DESCRIPTION
+*
+*       Returns the allocation counts gathered by NUSE_Partition_Allocate_Size()
+*       for a partition pool, which may be used to tune the pool sizes
+*
+*   INPUTS
+*
+*       NUSE_PARTITION_POOL pool    index of pool about which statistics are required
+*       U16 *hits                   pointer to storage for number of requests for which this was the best fit
+*       U16 *fallbacks              pointer to storage for number of requests served because smaller pools were full
+*       U16 *failures               pointer to storage for number of failed requests for which this was the best fit
+*
+*   RETURNS
+*
+*       NUSE_SUCCESS                the pool statistics were successfully returned
+*       NUSE_INVALID_POOL           the pool index was not valid
+*       NUSE_INVALID_POINTER        one or more of the pointer parameters was NULL
+*
+*   OTHER OUTPUTS
+*
+*       U16 *hits                   number of hits since initialization [wraps around]
+*       U16 *fallbacks              number of fallbacks since initialization [wraps around]
+*       U16 *failures               number of failures since initialization [wraps around]
+*
+*************************************************************************/
+
+#if NUSE_PARTITION_POOL_STATISTICS || (NUSE_INCLUDE_EVERYTHING && (NUSE_PARTITION_POOL_NUMBER != 0))
+
+    STATUS NUSE_Partition_Pool_Statistics(NUSE_PARTITION_POOL pool, U16 *hits, U16 *fallbacks, U16 *failures)
+    {
+        #if NUSE_API_PARAMETER_CHECKING
+            if (pool >= NUSE_PARTITION_POOL_NUMBER)
+            {
+                return NUSE_INVALID_POOL;
+            }
+
+            if ((hits == NULL) || (fallbacks == NULL) || (failures == NULL))
+            {
+                return NUSE_INVALID_POINTER;
+            }
+        #endif
+
+        NUSE_CS_Enter();
+
+        *hits = NUSE_Partition_Pool_Hits[pool];
+        *fallbacks = NUSE_Partition_Pool_Fallbacks[pool];
+        *failures = NUSE_Partition_Pool_Failures[pool];
+
+        NUSE_CS_Exit();
+
+        return NUSE_SUCCESS;
+    }
+
+#endif
+
+
 /*************************************************************************
 *
 *   FUNCTION
@@ -364,3 +727,142 @@
     }
 
 #endif
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Partition_Take()
+*
+*   DESCRIPTION
+*
+*       Takes the first partition from the free list of the specified pool and marks it used
+*       Must be called in a critical section, and only if the pool has a free partition
+*
+*   INPUTS
+*
+*       NUSE_PARTITION_POOL pool    index of pool from which allocation is required
+*
+*   RETURNS
+*
+*       ADDR value                  pointer to allocated partition data area
+*
+*   OTHER OUTPUTS
+*
+*       (none)
+*
+*************************************************************************/
+
+#if NUSE_PARTITION_ALLOCATE || NUSE_PARTITION_ALLOCATE_SIZE || (NUSE_INCLUDE_EVERYTHING && (NUSE_PARTITION_POOL_NUMBER != 0))
+
+    ADDR NUSE_Partition_Take(NUSE_PARTITION_POOL pool)
+    {
+        U8 *ptr;
+        NUSE_PARTITION_COUNT slot;
+
+        slot = NUSE_Partition_Pool_Free_Head[pool];                 /* take the first free partition */
+        NUSE_Partition_Pool_Free_Head[pool] = NUSE_Partition_Pool_Free_List[pool][slot];
+        NUSE_Partition_Pool_Free_List[pool][slot] = NUSE_PARTITION_IN_USE;
+        #if NUSE_PARTITION_REFERENCE || NUSE_PARTITION_SEND || NUSE_INCLUDE_EVERYTHING
+            NUSE_Partition_Pool_References[pool][slot] = 0;
+        #endif
+        ptr = (U8 *)NUSE_Partition_Pool_Data_Address[pool] + (U32)slot * NUSE_PARTITION_STRIDE(pool);
+        #if NUSE_PARTITION_ALIGNMENT == 0
+            *ptr++ = 0x80 | pool;                                   /* mark used in status byte */
+                                                                    /* need pool number for deallocation */
+        #endif
+        NUSE_Partition_Pool_Partition_Used[pool]++;
+
+        #if NUSE_DEADLOCK_PARTITIONS
+            if (NUSE_Task_State == NUSE_TASK_CONTEXT)
+            {
+                NUSE_Partition_Pool_Held[pool][NUSE_Task_Active]++;     /* charged to the allocating task */
+            }
+        #endif
+
+        return ptr;
+    }
+
+#endif
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Partition_Locate()
+*
+*   DESCRIPTION
+*
+*       Finds the pool and index of an allocated partition from its address
+*       Must be called in a critical section
+*
+*   INPUTS
+*
+*       ADDR partition              pointer to [address of] partition
+*       U8 *pool                    pointer to storage for the pool index
+*       NUSE_PARTITION_COUNT *slot  pointer to storage for the partition index within the pool
+*
+*   RETURNS
+*
+*       NUSE_SUCCESS                partition found
+*       NUSE_INVALID_POINTER        supplied pointer does not appear to point to an allocated partition
+*
+*   OTHER OUTPUTS
+*
+*       U8 *pool                    pool index
+*       NUSE_PARTITION_COUNT *slot  partition index within the pool
+*
+*************************************************************************/
+
+#if NUSE_PARTITION_DEALLOCATE || NUSE_PARTITION_REFERENCE || NUSE_PARTITION_SEND || (NUSE_INCLUDE_EVERYTHING && (NUSE_PARTITION_POOL_NUMBER != 0))
+
+    STATUS NUSE_Partition_Locate(ADDR partition, U8 *pool, NUSE_PARTITION_COUNT *slot)
+    {
+        U8 index;
+        U8 *block;
+        U32 offset;
+
+        #if NUSE_PARTITION_ALIGNMENT == 0
+            block = (U8 *)partition - 1;                    /* point to status byte */
+            if ((*block & 0xf0) == 0x80)                    /* check it is a used partition */
+            {
+                index = *block & 0x0f;                      /* extract pool index number */
+            }
+            else
+            {
+                index = NUSE_PARTITION_POOL_NUMBER;
+            }
+        #else
+            block = (U8 *)partition;
+            for (index=0; index<NUSE_PARTITION_POOL_NUMBER; index++)  /* find the pool which contains it */
+            {
+                if ((block >= (U8 *)NUSE_Partition_Pool_Data_Address[index])
+                    && (block < (U8 *)NUSE_Partition_Pool_Data_Address[index]
+                                + (U32)NUSE_Partition_Pool_Partition_Number[index] * NUSE_PARTITION_STRIDE(index)))
+                {
+                    break;
+                }
+            }
+        #endif
+
+        if (index >= NUSE_PARTITION_POOL_NUMBER)
+        {
+            return NUSE_INVALID_POINTER;
+        }
+                                                            /* find partition index from its address */
+        offset = block - (U8 *)NUSE_Partition_Pool_Data_Address[index];
+        *pool = index;
+        *slot = offset / NUSE_PARTITION_STRIDE(index);
+        if ((*slot < NUSE_Partition_Pool_Partition_Number[index])
+            && (offset == (U32)*slot * NUSE_PARTITION_STRIDE(index))
+            && (NUSE_Partition_Pool_Free_List[index][*slot] == NUSE_PARTITION_IN_USE))
+        {
+            return NUSE_SUCCESS;                            /* partition is allocated */
+        }
+
+        return NUSE_INVALID_POINTER;
+    }
+
+#endif
@@ -8,6 +8,7 @@
 *   NUSE_Pipe_Send()
 *   NUSE_Pipe_Receive()
 *   NUSE_Pipe_Jam()
+*   NUSE_Pipe_Broadcast()
 *   NUSE_Pipe_Reset()
 *   NUSE_Pipe_Information()
 *   NUSE_Pipe_Count()
@@ -129,6 +130,13 @@
                     }
 
                     NUSE_Pipe_Items[pipe]++;
+                    NUSE_RECORD_PEAK(NUSE_Pipe_Peak[pipe], NUSE_Pipe_Items[pipe]);
+                    #if NUSE_TASK_WAIT_MULTIPLE || NUSE_INCLUDE_EVERYTHING
+                        if (NUSE_Multiple_Blocking_Count != 0)
+                        {
+                            NUSE_Wake_Multiple((pipe << 4) | NUSE_PIPE_SUSPEND);
+                        }
+                    #endif
                     if (NUSE_Pipe_Blocking_Count[pipe] != 0)
                     {
                         U8 index;                                           /* check whether a task is blocked */
@@ -170,6 +178,7 @@
                 }
 
                 NUSE_Pipe_Items[pipe]++;
+                NUSE_RECORD_PEAK(NUSE_Pipe_Peak[pipe], NUSE_Pipe_Items[pipe]);
                 return_value = NUSE_SUCCESS;
             }
         #endif
@@ -269,8 +278,19 @@
                     else
                     {                                                       /* block task */
                         NUSE_Pipe_Blocking_Count[pipe]++;
+                        #if NUSE_QUEUE_BROADCAST || NUSE_PIPE_BROADCAST || NUSE_INCLUDE_EVERYTHING
+                            NUSE_Task_Receive_Buffer[NUSE_Task_Active] = message;
+                        #endif
                         NUSE_Suspend_Task(NUSE_Task_Active, (pipe << 4) | NUSE_PIPE_SUSPEND);
                         return_value = NUSE_Task_Blocking_Return[NUSE_Task_Active];
+                        #if NUSE_QUEUE_BROADCAST || NUSE_PIPE_BROADCAST || NUSE_INCLUDE_EVERYTHING
+                            if (NUSE_Task_Receive_Buffer[NUSE_Task_Active] == NULL)
+                            {                                               /* message delivered by broadcast */
+                                *actual_size = msgsize;
+                                suspend = NUSE_NO_SUSPEND;
+                            }
+                            NUSE_Task_Receive_Buffer[NUSE_Task_Active] = NULL;
+                        #endif
                         if (return_value != NUSE_SUCCESS)
                         {
                             suspend = NUSE_NO_SUSPEND;
@@ -458,6 +478,13 @@
                         *data++ = *message++;
                     }
                     NUSE_Pipe_Items[pipe]++;
+                    NUSE_RECORD_PEAK(NUSE_Pipe_Peak[pipe], NUSE_Pipe_Items[pipe]);
+                    #if NUSE_TASK_WAIT_MULTIPLE || NUSE_INCLUDE_EVERYTHING
+                        if (NUSE_Multiple_Blocking_Count != 0)
+                        {
+                            NUSE_Wake_Multiple((pipe << 4) | NUSE_PIPE_SUSPEND);
+                        }
+                    #endif
                     if (NUSE_Pipe_Blocking_Count[pipe] != 0)
                     {
                         U8 index;                                           /* check whether a task is blocked */
@@ -500,6 +527,7 @@
                     *data++ = *message++;
                 }
                 NUSE_Pipe_Items[pipe]++;
+                NUSE_RECORD_PEAK(NUSE_Pipe_Peak[pipe], NUSE_Pipe_Items[pipe]);
                 return_value = NUSE_SUCCESS;
             }
         #endif
@@ -512,6 +540,112 @@
 #endif
 
 
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Pipe_Broadcast()
+*
+*   DESCRIPTION
+*
+*       Sends a single (type U8[]) message to every task blocked on receive from the pipe
+*       All waiting tasks are given the message within one critical section; the message
+*       bypasses the pipe data area and none of the tasks needs to retry the receive
+*       If no task is waiting, the message is sent to the pipe in the normal way
+*
+*   INPUTS
+*
+*       NUSE_PIPE pipe          index of pipe to be used
+*       U8 *message             pointer to the message to be sent
+*       U8 size                 message size; must correspond to the size configured for the pipe [in nuse_config.c]
+*       U8 suspend              task suspend option - must be NUSE_NO_SUSPEND or NUSE_SUSPEND
+*                               depending upon the setting of NUSE_BLOCKING_ENABLE
+*
+*   RETURNS
+*
+*       NUSE_SUCCESS            message successfully sent
+*       NUSE_PIPE_FULL          send failed as no task was waiting and there was no room in the pipe
+*       NUSE_INVALID_PIPE       specified pipe index is invalid
+*       NUSE_INVALID_POINTER    message pointer [message] is NULL
+*       NUSE_INVALID_SIZE       message size parameter [size] did not correspond to the size configured for the pipe
+*       NUSE_INVALID_SUSPEND    task suspend option is not set to NUSE_NO_SUSPEND or NUSE_SUSPEND
+*
+*   OTHER OUTPUTS
+*
+*       (none)
+*
+*************************************************************************/
+
+#if NUSE_PIPE_BROADCAST || (NUSE_INCLUDE_EVERYTHING && (NUSE_PIPE_NUMBER != 0))
+
+    STATUS NUSE_Pipe_Broadcast(NUSE_PIPE pipe, U8 *message, U8 size, U8 suspend)
+    {
+        #if NUSE_API_PARAMETER_CHECKING
+            if (pipe >= NUSE_PIPE_NUMBER)
+            {
+                return NUSE_INVALID_PIPE;
+            }
+
+            if (message == NULL)
+            {
+                return NUSE_INVALID_POINTER;
+            }
+
+            if (size != NUSE_Pipe_Message_Size[pipe])
+            {
+                return NUSE_INVALID_SIZE;
+            }
+        #endif
+
+        #if NUSE_BLOCKING_ENABLE
+            NUSE_CS_Enter();
+
+            if (NUSE_Pipe_Blocking_Count[pipe] != 0)
+            {
+                U8 index, i, msgsize, *data;                                /* deliver to every task blocked */
+                U8 delivered = FALSE;                                       /* in receive on this pipe */
+
+                msgsize = NUSE_Pipe_Message_Size[pipe];
+                for (index=0; index<NUSE_TASK_NUMBER; index++)
+                {
+                    if ((LONIB(NUSE_Task_Status[index]) == NUSE_PIPE_SUSPEND)
+                        && (HINIB(NUSE_Task_Status[index]) == pipe)
+                        && (NUSE_Task_Receive_Buffer[index] != NULL))       /* senders blocked on a full pipe have no buffer */
+                    {
+                        data = (U8 *)NUSE_Task_Receive_Buffer[index];
+                        for (i=0; i<msgsize; i++)
+                        {
+                            *data++ = message[i];
+                        }
+                        NUSE_Task_Receive_Buffer[index] = NULL;
+                        NUSE_Pipe_Blocking_Count[pipe]--;
+                        NUSE_Task_Blocking_Return[index] = NUSE_SUCCESS;
+                        NUSE_TRACE(NUSE_TRACE_WAKE, index, 0);
+                        NUSE_LATENCY_WAKE(index);
+                        NUSE_Task_Status[index] = NUSE_READY;
+                        delivered = TRUE;
+                    }
+                }
+
+                if (delivered)
+                {
+                    #if NUSE_SCHEDULER_TYPE == NUSE_PRIORITY_SCHEDULER
+                        NUSE_Reschedule(NUSE_NO_TASK);
+                    #endif
+                    NUSE_CS_Exit();
+                    return NUSE_SUCCESS;
+                }
+            }
+
+            NUSE_CS_Exit();
+        #endif
+
+        return NUSE_Pipe_Send(pipe, message, size, suspend);
+    }
+
+#endif
+
+
 /*************************************************************************
 *
 *   FUNCTION
@@ -569,6 +703,8 @@
                         && (HINIB(NUSE_Task_Status[index]) == pipe))
                     {
                         NUSE_Task_Blocking_Return[index] = NUSE_PIPE_RESET;
+                        NUSE_TRACE(NUSE_TRACE_WAKE, index, 0);
+                        NUSE_LATENCY_WAKE(index);
                         NUSE_Task_Status[index] = NUSE_READY;
                         break;
                     }
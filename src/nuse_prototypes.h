@@ -17,23 +17,40 @@
 STATUS      NUSE_Task_Suspend(NUSE_TASK task);
 STATUS      NUSE_Task_Resume(NUSE_TASK task);
 void        NUSE_Task_Sleep(U16 ticks);
+STATUS      NUSE_Task_Wait_Multiple(U8 *objects, NUSE_EVENT_FLAGS *events, OPTION *operations, U8 count, U8 *ready, U8 suspend);
 void        NUSE_Task_Relinquish(void);
 NUSE_TASK   NUSE_Task_Current(void);
 U16         NUSE_Task_Check_Stack(U8 dummy);
+STATUS      NUSE_Task_Stack_High_Water(NUSE_TASK task, U16 *high_water);
 STATUS      NUSE_Task_Reset(NUSE_TASK task);
 STATUS      NUSE_Task_Information(NUSE_TASK task, U8 *task_status, U16 *scheduled_count, ADDR *stack_base, U16 *stack_size);
+STATUS      NUSE_Task_Runtime(NUSE_TASK task, U32 *runtime);
+STATUS      NUSE_Task_Load(NUSE_TASK idle_task, U32 *elapsed, U8 *load);
+void        NUSE_Task_Runtime_Reset(void);
 U8          NUSE_Task_Count(void);
 
 /* Partition Memory */
 
 STATUS  NUSE_Partition_Allocate(NUSE_PARTITION_POOL pool, ADDR *return_pointer, U8 suspend);
+STATUS  NUSE_Partition_Allocate_Size(U16 size, ADDR *return_pointer);
 STATUS  NUSE_Partition_Deallocate(ADDR partition);
-STATUS  NUSE_Partition_Pool_Information(NUSE_PARTITION_POOL pool, ADDR *start_address, U32 *pool_size, U16 *partition_size, U8 *available, U8 *allocated, U8 *tasks_waiting, NUSE_TASK *first_task);
+STATUS  NUSE_Partition_Reference(ADDR partition);
+STATUS  NUSE_Partition_Send(ADDR partition, NUSE_QUEUE *queues, U8 count, U8 *sent);
+STATUS  NUSE_Partition_Pool_Information(NUSE_PARTITION_POOL pool, ADDR *start_address, U32 *pool_size, U16 *partition_size, NUSE_PARTITION_COUNT *available, NUSE_PARTITION_COUNT *allocated, U8 *tasks_waiting, NUSE_TASK *first_task);
+STATUS  NUSE_Partition_Pool_Statistics(NUSE_PARTITION_POOL pool, U16 *hits, U16 *fallbacks, U16 *failures);
 U8      NUSE_Partition_Pool_Count(void);
 
+/* Dynamic Memory */
+
+STATUS  NUSE_Memory_Allocate(NUSE_MEMORY_POOL pool, ADDR *return_pointer, U16 size, U8 suspend);
+STATUS  NUSE_Memory_Deallocate(ADDR memory);
+STATUS  NUSE_Memory_Pool_Information(NUSE_MEMORY_POOL pool, ADDR *start_address, U16 *pool_size, U16 *min_allocation, U16 *available, U8 *tasks_waiting, NUSE_TASK *first_task);
+U8      NUSE_Memory_Pool_Count(void);
+
 /* Mailboxes */
 
 STATUS  NUSE_Mailbox_Send(NUSE_MAILBOX mailbox, ADDR *message, U8 suspend);
+STATUS  NUSE_Mailbox_Overwrite(NUSE_MAILBOX mailbox, ADDR *message);
 STATUS  NUSE_Mailbox_Receive(NUSE_MAILBOX mailbox, ADDR *message, U8 suspend);
 STATUS  NUSE_Mailbox_Reset(NUSE_MAILBOX mailbox);
 STATUS  NUSE_Mailbox_Information(NUSE_MAILBOX mailbox, U8 *message_present, U8 *tasks_waiting, NUSE_TASK *first_task);
@@ -44,6 +61,7 @@ U8      NUSE_Mailbox_Count(void);
 STATUS  NUSE_Queue_Send(NUSE_QUEUE queue, ADDR *message, U8 suspend);
 STATUS  NUSE_Queue_Receive(NUSE_QUEUE queue, ADDR *message, U8 suspend);
 STATUS  NUSE_Queue_Jam(NUSE_QUEUE queue, ADDR *message, U8 suspend);
+STATUS  NUSE_Queue_Broadcast(NUSE_QUEUE queue, ADDR *message, U8 suspend);
 STATUS  NUSE_Queue_Reset(NUSE_QUEUE queue);
 STATUS  NUSE_Queue_Information(NUSE_QUEUE queue, ADDR *start_address, U8 *queue_size, U8 *available, U8 *messages, U8 *tasks_waiting, NUSE_TASK *first_task);
 U8      NUSE_Queue_Count(void);
@@ -53,29 +71,48 @@ U8      NUSE_Queue_Count(void);
 STATUS  NUSE_Pipe_Send(NUSE_PIPE pipe, U8 *message, U8 size, U8 suspend);
 STATUS  NUSE_Pipe_Receive(NUSE_PIPE pipe, U8 *message, U8 size, U8 *actual_size, U8 suspend);
 STATUS  NUSE_Pipe_Jam(NUSE_PIPE pipe, U8 *message, U8 size, U8 suspend);
+STATUS  NUSE_Pipe_Broadcast(NUSE_PIPE pipe, U8 *message, U8 size, U8 suspend);
 STATUS  NUSE_Pipe_Reset(NUSE_PIPE pipe);
 STATUS  NUSE_Pipe_Information(NUSE_PIPE pipe, ADDR *start_address, U8 *pipe_size, U8 *available, U8 *messages, U8 *message_size, U8 *tasks_waiting, NUSE_TASK *first_task);
 U8      NUSE_Pipe_Count(void);
 
+/* Channels */
+
+STATUS  NUSE_Channel_Put(NUSE_CHANNEL channel, ADDR *message);
+STATUS  NUSE_Channel_Get(NUSE_CHANNEL channel, ADDR *message, U8 suspend);
+STATUS  NUSE_Channel_Information(NUSE_CHANNEL channel, ADDR *start_address, U8 *channel_size, U8 *available, U8 *messages, U8 *tasks_waiting, NUSE_TASK *first_task);
+U8      NUSE_Channel_Count(void);
+
+/* State Boards */
+
+STATUS  NUSE_Board_Write(NUSE_BOARD board, U8 *data, U8 size);
+STATUS  NUSE_Board_Read(NUSE_BOARD board, U8 *data, U8 size);
+STATUS  NUSE_Board_Information(NUSE_BOARD board, ADDR *start_address, U8 *record_size, U16 *updates);
+U8      NUSE_Board_Count(void);
+
 /* Semaphores */
 
 STATUS  NUSE_Semaphore_Obtain(NUSE_SEMAPHORE semaphore, U8 suspend);
 STATUS  NUSE_Semaphore_Release(NUSE_SEMAPHORE semaphore);
-STATUS  NUSE_Semaphore_Reset(NUSE_SEMAPHORE semaphore, U8 initial_count);
-STATUS  NUSE_Semaphore_Information(NUSE_SEMAPHORE semaphore, U8 *current_count, U8 *tasks_waiting, NUSE_TASK *first_task);
+STATUS  NUSE_Semaphore_Reset(NUSE_SEMAPHORE semaphore, NUSE_SEMAPHORE_COUNTER initial_count);
+STATUS  NUSE_Semaphore_Information(NUSE_SEMAPHORE semaphore, NUSE_SEMAPHORE_COUNTER *current_count, U8 *tasks_waiting, NUSE_TASK *first_task);
 U8      NUSE_Semaphore_Count(void);
+STATUS  NUSE_Binary_Semaphore_Obtain(NUSE_BINARY_SEMAPHORE semaphore, U8 suspend);
+STATUS  NUSE_Binary_Semaphore_Release(NUSE_BINARY_SEMAPHORE semaphore);
+U8      NUSE_Binary_Semaphore_Count(void);
 
 /* Event Groups */
 
-STATUS  NUSE_Event_Group_Set(NUSE_EVENT_GROUP group, U8 event_flags, OPTION operation);
-STATUS  NUSE_Event_Group_Retrieve(NUSE_EVENT_GROUP group, U8 requested_events, OPTION operation, U8 *retrieved_events, U8 suspend);
-STATUS  NUSE_Event_Group_Information(NUSE_EVENT_GROUP group, U8 *event_flags, U8 *tasks_waiting, NUSE_TASK *first_task);
+STATUS  NUSE_Event_Group_Set(NUSE_EVENT_GROUP group, NUSE_EVENT_FLAGS event_flags, OPTION operation);
+STATUS  NUSE_Event_Group_Retrieve(NUSE_EVENT_GROUP group, NUSE_EVENT_FLAGS requested_events, OPTION operation, NUSE_EVENT_FLAGS *retrieved_events, U8 suspend);
+STATUS  NUSE_Event_Group_Information(NUSE_EVENT_GROUP group, NUSE_EVENT_FLAGS *event_flags, U8 *tasks_waiting, NUSE_TASK *first_task);
 U8      NUSE_Event_Group_Count(void);
 
 /* Signals */
 
 STATUS  NUSE_Signals_Send(NUSE_TASK task, U8 signals);
 U8      NUSE_Signals_Receive(void);
+U8      NUSE_Signals_Wait(U8 mask, U8 suspend);
 
 /* Timers */
 
@@ -93,6 +130,34 @@ U32     NUSE_Clock_Retrieve(void);
 /* System Diagnostics */
 
 char  *NUSE_Release_Information(void);
+void    NUSE_Trace_Entry(U8 api);
+STATUS  NUSE_Trace_Exit(STATUS status);
+void    NUSE_Trace_ISR(U8 event);
+
+/* Statistics */
+
+STATUS  NUSE_Wait_Statistics(U8 object, U16 *blocks, U8 *max_waiters, U32 *total_time, U32 *max_time, U8 *peak_items);
+void    NUSE_Wait_Statistics_Reset(void);
+void    NUSE_CS_Profile_Enter(void);
+void    NUSE_CS_Profile_Exit(char *file, U16 line);
+STATUS  NUSE_CS_Profile_Site(U8 site, char **file, U16 *line, U16 *count, U32 *worst);
+STATUS  NUSE_CS_Profile_Histogram(U32 *counts, U32 *worst);
+void    NUSE_CS_Profile_Reset(void);
+void    NUSE_Latency_ISR(void);
+STATUS  NUSE_Latency_Histogram(U8 latency, U32 *counts, U32 *worst);
+STATUS  NUSE_Latency_Percentile(U8 latency, U8 percent, U32 *bound);
+void    NUSE_Latency_Reset(void);
+
+/* Deadlock Detection */
+
+STATUS  NUSE_Deadlock_Information(U8 *length, NUSE_TASK *tasks, U8 *objects);
+
+/* Task Watchdog */
+
+STATUS  NUSE_Watchdog_Start(NUSE_TASK task, U16 period);
+STATUS  NUSE_Watchdog_Check_In(void);
+STATUS  NUSE_Watchdog_Stop(NUSE_TASK task);
+void    NUSE_Watchdog_Reset(NUSE_TASK task);
 
 /* Scheduler functions */
 
@@ -108,6 +173,25 @@ char  *NUSE_Release_Information(void);
 #endif
 void NUSE_Wake_Task(NUSE_TASK task);
 void NUSE_Suspend_Task(NUSE_TASK task, U8 suspend_code);
+U8 NUSE_Valid_Object(U8 object);
+U8 NUSE_Object_Ready(NUSE_TASK task, U8 entry);
+void NUSE_Wake_Multiple(U8 object);
+ADDR NUSE_Partition_Take(NUSE_PARTITION_POOL pool);
+STATUS NUSE_Partition_Locate(ADDR partition, U8 *pool, NUSE_PARTITION_COUNT *slot);
+U8 NUSE_Wait_Statistics_Entry(U8 object);
+U8 NUSE_Wait_Statistics_Block(U8 object);
+U8 NUSE_Histogram_Bucket(U32 value);
+void NUSE_Latency_Swap_Out(void);
+void NUSE_Latency_Swap_In(void);
+U16 NUSE_Deadlock_Holders(U8 object);
+U8 NUSE_Deadlock_Check(U8 object);
+U8 NUSE_Deadlock_Cycle(U16 *waits);
+void NUSE_Deadlock_Partition_Free(NUSE_PARTITION_POOL pool);
+void NUSE_Watchdog_Insert(NUSE_TASK task);
+void NUSE_Watchdog_Remove(NUSE_TASK task);
+void NUSE_Watchdog_Restart(void);
+void NUSE_Memory_Insert(NUSE_MEMORY_POOL pool, U16 offset);
+void NUSE_Memory_Remove(NUSE_MEMORY_POOL pool, U16 offset);
 void NUSE_Scheduler(void);
 
 /* Initialization */
@@ -115,12 +199,19 @@ void NUSE_Scheduler(void);
 void NUSE_Init(void);
 void NUSE_Init_Task(NUSE_TASK);
 void NUSE_Init_Partition_Pool(NUSE_PARTITION_POOL);
+void NUSE_Init_Memory_Pool(NUSE_MEMORY_POOL);
 void NUSE_Init_Mailbox(NUSE_MAILBOX);
 void NUSE_Init_Queue(NUSE_QUEUE);
 void NUSE_Init_Pipe(NUSE_PIPE);
+void NUSE_Init_Channel(NUSE_CHANNEL);
+void NUSE_Init_Board(NUSE_BOARD);
 void NUSE_Init_Semaphore(NUSE_SEMAPHORE);
+void NUSE_Init_Binary_Semaphore(NUSE_BINARY_SEMAPHORE);
 void NUSE_Init_Event_Group(NUSE_EVENT_GROUP);
 void NUSE_Init_Timer(NUSE_TIMER);
+void NUSE_Init_Wait_Statistics(void);
+void NUSE_Init_CS_Profile(void);
+void NUSE_Init_Latency(void);
 
 /* Interrupts */
 
@@ -8,6 +8,7 @@
 *   NUSE_Queue_Send()
 *   NUSE_Queue_Receive()
 *   NUSE_Queue_Jam()
+*   NUSE_Queue_Broadcast()
 *   NUSE_Queue_Reset()
 *   NUSE_Queue_Information()
 *   NUSE_Queue_Count()
@@ -112,6 +113,13 @@
                         NUSE_Queue_Head[queue] = 0;
                     }
                     NUSE_Queue_Items[queue]++;
+                    NUSE_RECORD_PEAK(NUSE_Queue_Peak[queue], NUSE_Queue_Items[queue]);
+                    #if NUSE_TASK_WAIT_MULTIPLE || NUSE_INCLUDE_EVERYTHING
+                        if (NUSE_Multiple_Blocking_Count != 0)
+                        {
+                            NUSE_Wake_Multiple((queue << 4) | NUSE_QUEUE_SUSPEND);
+                        }
+                    #endif
                     if (NUSE_Queue_Blocking_Count[queue] != 0)
                     {
                         U8 index;                                           /* check whether a task is blocked */
@@ -146,6 +154,7 @@
                     NUSE_Queue_Head[queue] = 0;
                 }
                 NUSE_Queue_Items[queue]++;
+                NUSE_RECORD_PEAK(NUSE_Queue_Peak[queue], NUSE_Queue_Items[queue]);
                 return_value = NUSE_SUCCESS;
             }
         #endif
@@ -233,8 +242,18 @@
                     else
                     {                                                       /* block task */
                         NUSE_Queue_Blocking_Count[queue]++;
+                        #if NUSE_QUEUE_BROADCAST || NUSE_PIPE_BROADCAST || NUSE_INCLUDE_EVERYTHING
+                            NUSE_Task_Receive_Buffer[NUSE_Task_Active] = message;
+                        #endif
                         NUSE_Suspend_Task(NUSE_Task_Active, (queue << 4) | NUSE_QUEUE_SUSPEND);
                         return_value = NUSE_Task_Blocking_Return[NUSE_Task_Active];
+                        #if NUSE_QUEUE_BROADCAST || NUSE_PIPE_BROADCAST || NUSE_INCLUDE_EVERYTHING
+                            if (NUSE_Task_Receive_Buffer[NUSE_Task_Active] == NULL)
+                            {                                               /* message delivered by broadcast */
+                                suspend = NUSE_NO_SUSPEND;
+                            }
+                            NUSE_Task_Receive_Buffer[NUSE_Task_Active] = NULL;
+                        #endif
                         if (return_value != NUSE_SUCCESS)
                         {
                             suspend = NUSE_NO_SUSPEND;
@@ -390,6 +409,13 @@
 
                     NUSE_Queue_Data[queue][NUSE_Queue_Tail[queue]] = *message;
                     NUSE_Queue_Items[queue]++;
+                    NUSE_RECORD_PEAK(NUSE_Queue_Peak[queue], NUSE_Queue_Items[queue]);
+                    #if NUSE_TASK_WAIT_MULTIPLE || NUSE_INCLUDE_EVERYTHING
+                        if (NUSE_Multiple_Blocking_Count != 0)
+                        {
+                            NUSE_Wake_Multiple((queue << 4) | NUSE_QUEUE_SUSPEND);
+                        }
+                    #endif
                     if (NUSE_Queue_Blocking_Count[queue] != 0)
                     {
                         U8 index;                                           /* check whether a task is blocked */
@@ -429,6 +455,7 @@
 
                 NUSE_Queue_Data[queue][NUSE_Queue_Tail[queue]] = *message;
                 NUSE_Queue_Items[queue]++;
+                NUSE_RECORD_PEAK(NUSE_Queue_Peak[queue], NUSE_Queue_Items[queue]);
                 return_value = NUSE_SUCCESS;
             }
         #endif
@@ -441,6 +468,100 @@
 #endif
 
 
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Queue_Broadcast()
+*
+*   DESCRIPTION
+*
+*       Sends a single (type ADDR) message to every task blocked on receive from the queue
+*       All waiting tasks are given the message within one critical section; the message
+*       bypasses the queue data area and none of the tasks needs to retry the receive
+*       If no task is waiting, the message is sent to the queue in the normal way
+*
+*   INPUTS
+*
+*       NUSE_QUEUE queue        index of queue to be used
+*       ADDR *message           pointer to the message to be sent
+*       U8 suspend              task suspend option - must be NUSE_NO_SUSPEND or NUSE_SUSPEND
+*                               depending upon the setting of NUSE_BLOCKING_ENABLE
+*
+*   RETURNS
+*
+*       NUSE_SUCCESS            message successfully sent
+*       NUSE_QUEUE_FULL         send failed as no task was waiting and there was no room in the queue
+*       NUSE_INVALID_QUEUE      specified queue index is invalid
+*       NUSE_INVALID_POINTER    message pointer [message] is NULL
+*       NUSE_INVALID_SUSPEND    task suspend option is not set to NUSE_NO_SUSPEND or NUSE_SUSPEND
+*
+*   OTHER OUTPUTS
+*
+*       (none)
+*
+*************************************************************************/
+
+#if NUSE_QUEUE_BROADCAST || (NUSE_INCLUDE_EVERYTHING && (NUSE_QUEUE_NUMBER != 0))
+
+    STATUS NUSE_Queue_Broadcast(NUSE_QUEUE queue, ADDR *message, U8 suspend)
+    {
+        #if NUSE_API_PARAMETER_CHECKING
+            if (queue >= NUSE_QUEUE_NUMBER)
+            {
+                return NUSE_INVALID_QUEUE;
+            }
+
+            if (message == NULL)
+            {
+                return NUSE_INVALID_POINTER;
+            }
+        #endif
+
+        #if NUSE_BLOCKING_ENABLE
+            NUSE_CS_Enter();
+
+            if (NUSE_Queue_Blocking_Count[queue] != 0)
+            {
+                U8 index;                                                   /* deliver to every task blocked */
+                U8 delivered = FALSE;                                       /* in receive on this queue */
+
+                for (index=0; index<NUSE_TASK_NUMBER; index++)
+                {
+                    if ((LONIB(NUSE_Task_Status[index]) == NUSE_QUEUE_SUSPEND)
+                        && (HINIB(NUSE_Task_Status[index]) == queue)
+                        && (NUSE_Task_Receive_Buffer[index] != NULL))       /* senders blocked on a full queue have no buffer */
+                    {
+                        *(ADDR *)NUSE_Task_Receive_Buffer[index] = *message;
+                        NUSE_Task_Receive_Buffer[index] = NULL;
+                        NUSE_Queue_Blocking_Count[queue]--;
+                        NUSE_Task_Blocking_Return[index] = NUSE_SUCCESS;
+                        NUSE_TRACE(NUSE_TRACE_WAKE, index, 0);
+                        NUSE_LATENCY_WAKE(index);
+                        NUSE_Task_Status[index] = NUSE_READY;
+                        delivered = TRUE;
+                    }
+                }
+
+                if (delivered)
+                {
+                    #if NUSE_SCHEDULER_TYPE == NUSE_PRIORITY_SCHEDULER
+                        NUSE_Reschedule(NUSE_NO_TASK);
+                    #endif
+                    NUSE_CS_Exit();
+                    return NUSE_SUCCESS;
+                }
+            }
+
+            NUSE_CS_Exit();
+        #endif
+
+        return NUSE_Queue_Send(queue, message, suspend);
+    }
+
+#endif
+
+
 /*************************************************************************
 *
 *   FUNCTION
@@ -498,6 +619,8 @@
                         && (HINIB(NUSE_Task_Status[index]) == queue))
                     {
                         NUSE_Task_Blocking_Return[index] = NUSE_QUEUE_WAS_RESET;
+                        NUSE_TRACE(NUSE_TRACE_WAKE, index, 0);
+                        NUSE_LATENCY_WAKE(index);
                         NUSE_Task_Status[index] = NUSE_READY;
                         break;
                     }
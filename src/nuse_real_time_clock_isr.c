@@ -16,11 +16,13 @@
 *   DESCRIPTION
 *
 *       Tick timer interrupt service routine [ISR]
-*       4 actions are performed, depending upon configuration:
+*       5 actions are performed, depending upon configuration:
 *       1) Process any configured timers; decrement counters and act upon expiration
 *       2) Increment the system clock, if configured
 *       3) Decrement any task timeout [sleep] counters and wake task as necessary
-*       4) If Time Slice scheduler, decrement counter and effect task swap on 0
+*       4) If the task watchdog is configured, decrement the first check-in deadline
+*          and call NUSE_WATCHDOG_HANDLER() for each task which has missed its deadline
+*       5) If Time Slice scheduler, decrement counter and effect task swap on 0
 *
 *   INPUTS
 *
@@ -53,6 +55,7 @@
             {
                 if (--NUSE_Timer_Value[timer] == 0)
                 {
+                    NUSE_TRACE(NUSE_TRACE_TIMER, NUSE_Task_Active, timer);
                     NUSE_Timer_Expirations_Counter[timer]++;
 
                     #if NUSE_TIMER_EXPIRATION_ROUTINE_SUPPORT || NUSE_INCLUDE_EVERYTHING
@@ -103,6 +106,30 @@
 
     #endif
 
+    #if NUSE_WATCHDOG_SUPPORT
+
+    {
+        NUSE_TASK task;
+
+        if (NUSE_Watchdog_Reset_Pending != 0)
+        {
+            NUSE_Watchdog_Restart();
+        }
+
+        if ((NUSE_Watchdog_Head != NUSE_NO_TASK) && (--NUSE_Watchdog_Delta[NUSE_Watchdog_Head] == 0))
+        {
+            do
+            {                                       /* check-in missed - stop watching */
+                task = NUSE_Watchdog_Head;
+                NUSE_Watchdog_Head = NUSE_Watchdog_Next[task];
+                NUSE_Watchdog_Period[task] = 0;
+                NUSE_WATCHDOG_HANDLER(task);
+            } while ((NUSE_Watchdog_Head != NUSE_NO_TASK) && (NUSE_Watchdog_Delta[NUSE_Watchdog_Head] == 0));
+        }
+    }
+
+    #endif
+
     #if NUSE_SCHEDULER_TYPE == NUSE_TIME_SLICE_SCHEDULER
 
         if (--NUSE_Time_Slice_Ticks == 0)
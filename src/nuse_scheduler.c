@@ -9,6 +9,9 @@
 *   NUSE_Reschedule() [Priority Scheduler version]
 *   NUSE_Wake_Task()
 *   NUSE_Suspend_Task()
+*   NUSE_Valid_Object()
+*   NUSE_Object_Ready()
+*   NUSE_Wake_Multiple()
 *
 ************************************************************************/
 
@@ -31,6 +34,8 @@
 *       The Run To Competion scheduler is an infinite loop which cycles around caling each taks in turn
 *       If task suspend is enabled, calls are dependent upon task status
 *       If schedule counting is configured, this count is maintained for each task
+*       If run time accounting is configured, the time since the last dispatch is charged
+*       to the previous task [including any ISRs which ran meanwhile]
 *       If task parameter support is configured, the argc and argv values in ROM are passed on each call
 *
 *   INPUTS
@@ -55,6 +60,10 @@
 
         NUSE_Task_State = NUSE_TASK_CONTEXT;
 
+        #if NUSE_RUNTIME_SUPPORT
+            NUSE_Run_Time_Switch = NUSE_CYCLE_COUNTER();    /* startup time is not charged to any task */
+        #endif
+
         while (TRUE)
         {
             for (task_count=0; task_count<NUSE_TASK_NUMBER; task_count++)
@@ -70,6 +79,18 @@
                             NUSE_CS_Exit();
                         #endif
 
+                        #if NUSE_TRACE_SUPPORT
+                            NUSE_CS_Enter();
+                            NUSE_TRACE(NUSE_TRACE_SWITCH, NUSE_Task_Active, task_count);
+                            NUSE_CS_Exit();
+                        #endif
+
+                        #if NUSE_RUNTIME_SUPPORT
+                            NUSE_CS_Enter();
+                            NUSE_RUN_TIME_SWITCH();
+                            NUSE_CS_Exit();
+                        #endif
+
                         NUSE_Task_Active = task_count;
                         ((PF0)NUSE_Task_Start_Address[task_count])();
                     }
@@ -130,6 +151,10 @@
         #if NUSE_SCHEDULE_COUNT_SUPPORT
             NUSE_Task_Schedule_Count[task]++;
         #endif
+        NUSE_TRACE(NUSE_TRACE_SWITCH, NUSE_Task_Active, task);
+        #if NUSE_RUNTIME_SUPPORT
+            NUSE_Run_Time_Switch = NUSE_CYCLE_COUNTER();    /* startup time is not charged to any task */
+        #endif
         NUSE_Task_Next = task;
         NUSE_Task_State = NUSE_TASK_CONTEXT;
         NUSE_Context_Load();
@@ -153,7 +178,12 @@
 *       If suspend is enabled, this is the next task set to NUSE_READY
 *       Otherwise, it is simply the next task
 *       If schedule counting is configured, this count is updated for this task
+*       If run time accounting is configured, the time since the last switch is charged
+*       to the outgoing task
+*       If the stack check is configured, the bottom word of the current task's stack
+*       is checked and the task is marked as overflowed if it has been overwritten
 *       If the function was not called from an ISR, the new task context is loaded before exit
+*       If latency measurement is configured, it is updated either side of the context swap
 *
 *   INPUTS
 *
@@ -173,6 +203,13 @@
 
     void NUSE_Reschedule(void)
     {
+        #if NUSE_STACK_CHECK_SWITCH                     /* check guard word of outgoing task */
+            if (*(U32 *)NUSE_Task_Stack_Base[NUSE_Task_Active] != NUSE_STACK_PAINT_VALUE)
+            {
+                NUSE_Task_Stack_Overflow |= (U16)1 << NUSE_Task_Active;
+            }
+        #endif
+
         #if NUSE_SUSPEND_ENABLE
             NUSE_Task_Next = NUSE_Task_Active;
             do
@@ -193,13 +230,22 @@
             NUSE_Task_Schedule_Count[NUSE_Task_Next]++;
         #endif
 
+        NUSE_TRACE(NUSE_TRACE_SWITCH, NUSE_Task_Active, NUSE_Task_Next);
+        NUSE_RUN_TIME_SWITCH();
+
         #if NUSE_SCHEDULER_TYPE == NUSE_TIME_SLICE_SCHEDULER    /* reset time slice tick counter */
             NUSE_Time_Slice_Ticks = NUSE_TIME_SLICE_TICKS;      /* done here to accommodate reliquish */
         #endif                                                  /* as well as ISR count down */
 
         if (NUSE_Task_State != NUSE_MISR_CONTEXT)
         {
+            #if NUSE_LATENCY_SUPPORT
+                NUSE_Latency_Swap_Out();
+            #endif
             NUSE_CONTEXT_SWAP();
+            #if NUSE_LATENCY_SUPPORT
+                NUSE_Latency_Swap_In();                 /* this task has been resumed */
+            #endif
         }
     }
 
@@ -221,7 +267,12 @@
 *       If no task index is supplied, the highest priority task which has the status NUSE_READY
 *       is scheduled
 *       If schedule counting is configured, this count is updated for this task
+*       If run time accounting is configured, the time since the last switch is charged
+*       to the outgoing task
+*       If the stack check is configured, the bottom word of the current task's stack
+*       is checked and the task is marked as overflowed if it has been overwritten
 *       If the function was not called from an ISR, the new task context is loaded before exit
+*       If latency measurement is configured, it is updated either side of the context swap
 *
 *   INPUTS
 *
@@ -263,10 +314,25 @@
             NUSE_Task_Schedule_Count[new_task]++;
         #endif
 
+        #if NUSE_STACK_CHECK_SWITCH                     /* check guard word of outgoing task */
+            if (*(U32 *)NUSE_Task_Stack_Base[NUSE_Task_Active] != NUSE_STACK_PAINT_VALUE)
+            {
+                NUSE_Task_Stack_Overflow |= (U16)1 << NUSE_Task_Active;
+            }
+        #endif
+
+        NUSE_TRACE(NUSE_TRACE_SWITCH, NUSE_Task_Active, new_task);
+        NUSE_RUN_TIME_SWITCH();
         NUSE_Task_Next = new_task;
         if (NUSE_Task_State != NUSE_MISR_CONTEXT)
         {
+            #if NUSE_LATENCY_SUPPORT
+                NUSE_Latency_Swap_Out();
+            #endif
             NUSE_CONTEXT_SWAP();
+            #if NUSE_LATENCY_SUPPORT
+                NUSE_Latency_Swap_In();                 /* this task has been resumed */
+            #endif
         }
     }
 
@@ -303,6 +369,8 @@
 
     void NUSE_Wake_Task(NUSE_TASK task)
     {
+        NUSE_TRACE(NUSE_TRACE_WAKE, task, 0);
+        NUSE_LATENCY_WAKE(task);
         NUSE_Task_Status[task] = NUSE_READY;
         #if NUSE_SCHEDULER_TYPE == NUSE_PRIORITY_SCHEDULER
             NUSE_Reschedule(task);
@@ -322,6 +390,10 @@
 *
 *       Specified task is suspended and NUSE_Reschedule() called to pass control
 *       to the next available task
+*       If wait statistics are configured and the current task is blocking on an object,
+*       the blocking event is counted and the time until the task is resumed is measured
+*       If latency measurement is configured, the time at which the current task blocked
+*       is recorded
 *
 *   INPUTS
 *
@@ -342,18 +414,262 @@
 
     void NUSE_Suspend_Task(NUSE_TASK task, U8 suspend_code)
     {
+        #if NUSE_WAIT_STATISTICS_SUPPORT
+            U8 entry;
+            U32 blocked;
+        #endif
+
+        NUSE_TRACE(NUSE_TRACE_SUSPEND, task, suspend_code);
         NUSE_Task_Status[task] = suspend_code;
         #if NUSE_BLOCKING_ENABLE
             NUSE_Task_Blocking_Return[task] = NUSE_SUCCESS;
         #endif
         if (task == NUSE_Task_Active)
         {
+            #if NUSE_LATENCY_SUPPORT
+                if (NUSE_Task_State == NUSE_TASK_CONTEXT)
+                {
+                    NUSE_Latency_Block_Time = NUSE_CYCLE_COUNTER();
+                    NUSE_Latency_Blocking = TRUE;
+                }
+            #endif
+
+            #if NUSE_WAIT_STATISTICS_SUPPORT
+                entry = NUSE_NO_WAIT_STATISTICS;
+                if (NUSE_Task_State == NUSE_TASK_CONTEXT)      /* only a task context is swapped out here */
+                {
+                    entry = NUSE_Wait_Statistics_Block(suspend_code);
+                    blocked = NUSE_CYCLE_COUNTER();
+                }
+            #endif
+
             #if NUSE_SCHEDULER_TYPE == NUSE_PRIORITY_SCHEDULER
                 NUSE_Reschedule(NUSE_NO_TASK);
             #else
                 NUSE_Reschedule();
             #endif
+
+            #if NUSE_WAIT_STATISTICS_SUPPORT
+                if (entry != NUSE_NO_WAIT_STATISTICS)       /* task has been resumed */
+                {
+                    blocked = NUSE_CYCLE_COUNTER() - blocked;
+                    NUSE_Wait_Total_Time[entry] += blocked;
+                    if (blocked > NUSE_Wait_Max_Time[entry])
+                    {
+                        NUSE_Wait_Max_Time[entry] = blocked;
+                    }
+                }
+            #endif
         }
     }
 
 #endif
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Valid_Object()
+*
+*   DESCRIPTION
+*
+*       Checks that an entry in a NUSE_Task_Wait_Multiple() list specifies a configured
+*       queue, pipe, mailbox, semaphore or event group
+*
+*   INPUTS
+*
+*       U8 object           object index and type, encoded as for NUSE_Task_Status
+*
+*   RETURNS
+*
+*       TRUE                the object is valid
+*       FALSE               the object type or index is not valid
+*
+*   OTHER OUTPUTS
+*
+*       (none)
+*
+*************************************************************************/
+
+#if (NUSE_TASK_WAIT_MULTIPLE || NUSE_INCLUDE_EVERYTHING) && NUSE_API_PARAMETER_CHECKING
+
+    U8 NUSE_Valid_Object(U8 object)
+    {
+        switch (LONIB(object))
+        {
+            #if NUSE_QUEUE_NUMBER != 0
+                case NUSE_QUEUE_SUSPEND:
+                    return (HINIB(object) < NUSE_QUEUE_NUMBER);
+            #endif
+            #if NUSE_PIPE_NUMBER != 0
+                case NUSE_PIPE_SUSPEND:
+                    return (HINIB(object) < NUSE_PIPE_NUMBER);
+            #endif
+            #if NUSE_MAILBOX_NUMBER != 0
+                case NUSE_MAILBOX_SUSPEND:
+                    return (HINIB(object) < NUSE_MAILBOX_NUMBER);
+            #endif
+            #if NUSE_SEMAPHORE_NUMBER != 0
+                case NUSE_SEMAPHORE_SUSPEND:
+                    return (HINIB(object) < NUSE_SEMAPHORE_NUMBER);
+            #endif
+            #if NUSE_EVENT_GROUP_NUMBER != 0
+                case NUSE_EVENT_SUSPEND:
+                    return (HINIB(object) < NUSE_EVENT_GROUP_NUMBER);
+            #endif
+            default:
+                return FALSE;
+        }
+    }
+
+#endif
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Object_Ready()
+*
+*   DESCRIPTION
+*
+*       Checks whether an entry in a task's NUSE_Task_Wait_Multiple() list is ready
+*       to be received from [or obtained] without blocking; an event group entry is
+*       ready when its requested flags satisfy its operation, as for
+*       NUSE_Event_Group_Retrieve(); must be called from within a critical section
+*
+*   INPUTS
+*
+*       NUSE_TASK task      index of the waiting task
+*       U8 entry            position in the task's list of the object to be checked
+*
+*   RETURNS
+*
+*       TRUE                the object is ready
+*       FALSE               the object is not ready
+*
+*   OTHER OUTPUTS
+*
+*       (none)
+*
+*************************************************************************/
+
+#if NUSE_TASK_WAIT_MULTIPLE || NUSE_INCLUDE_EVERYTHING
+
+    U8 NUSE_Object_Ready(NUSE_TASK task, U8 entry)
+    {
+        U8 object;
+        #if NUSE_EVENT_GROUP_NUMBER != 0
+            NUSE_EVENT_FLAGS requested_events, temp_events;
+            OPTION operation;
+        #endif
+
+        object = NUSE_Task_Wait_List[task][entry];
+
+        switch (LONIB(object))
+        {
+            #if NUSE_QUEUE_NUMBER != 0
+                case NUSE_QUEUE_SUSPEND:
+                    return (NUSE_Queue_Items[HINIB(object)] != 0);
+            #endif
+            #if NUSE_PIPE_NUMBER != 0
+                case NUSE_PIPE_SUSPEND:
+                    return (NUSE_Pipe_Items[HINIB(object)] != 0);
+            #endif
+            #if NUSE_MAILBOX_NUMBER != 0
+                case NUSE_MAILBOX_SUSPEND:
+                    return NUSE_Mailbox_Status[HINIB(object)];
+            #endif
+            #if NUSE_SEMAPHORE_NUMBER != 0
+                case NUSE_SEMAPHORE_SUSPEND:
+                    return (NUSE_Semaphore_Counter[HINIB(object)] != 0);
+            #endif
+            #if NUSE_EVENT_GROUP_NUMBER != 0
+                case NUSE_EVENT_SUSPEND:
+                    requested_events = NUSE_Task_Wait_Events[task][entry];
+                    operation = NUSE_Task_Wait_Operations[task][entry];
+                    temp_events = NUSE_Event_Group_Data[HINIB(object)] & requested_events;
+                    if ((operation == NUSE_OR) || (operation == NUSE_OR_CONSUME))
+                    {
+                        return (temp_events != 0);
+                    }
+                    return (temp_events == requested_events);
+            #endif
+            default:
+                return FALSE;
+        }
+    }
+
+#endif
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Wake_Multiple()
+*
+*   DESCRIPTION
+*
+*       Called when a kernel object may have become ready, to wake any task blocked in
+*       NUSE_Task_Wait_Multiple() with that object in its list, if its entry is ready
+*       Woken tasks re-check their list, so a task which loses a race for the object
+*       just blocks again
+*       Callers check NUSE_Multiple_Blocking_Count first, so the list scan is only
+*       done when a task is actually waiting; must be called from within a critical section
+*
+*   INPUTS
+*
+*       U8 object           object index and type, encoded as for NUSE_Task_Status
+*
+*   RETURNS
+*
+*       (none)
+*
+*   OTHER OUTPUTS
+*
+*       (none)
+*
+*************************************************************************/
+
+#if (NUSE_TASK_WAIT_MULTIPLE || NUSE_INCLUDE_EVERYTHING) && NUSE_BLOCKING_ENABLE
+
+    void NUSE_Wake_Multiple(U8 object)
+    {
+        U8 index, entry;
+        #if NUSE_SCHEDULER_TYPE == NUSE_PRIORITY_SCHEDULER
+            U8 woken = FALSE;
+        #endif
+
+        for (index=0; index<NUSE_TASK_NUMBER; index++)
+        {
+            if (NUSE_Task_Status[index] == NUSE_MULTIPLE_SUSPEND)
+            {
+                for (entry=0; entry<NUSE_Task_Wait_Count[index]; entry++)
+                {
+                    if ((NUSE_Task_Wait_List[index][entry] == object) && NUSE_Object_Ready(index, entry))
+                    {
+                        NUSE_TRACE(NUSE_TRACE_WAKE, index, 0);
+                        NUSE_LATENCY_WAKE(index);
+                        NUSE_Task_Blocking_Return[index] = NUSE_SUCCESS;
+                        NUSE_Task_Status[index] = NUSE_READY;
+                        NUSE_Multiple_Blocking_Count--;
+                        #if NUSE_SCHEDULER_TYPE == NUSE_PRIORITY_SCHEDULER
+                            woken = TRUE;
+                        #endif
+                        break;
+                    }
+                }
+            }
+        }
+
+        #if NUSE_SCHEDULER_TYPE == NUSE_PRIORITY_SCHEDULER
+            if (woken)
+            {
+                NUSE_Reschedule(NUSE_NO_TASK);
+            }
+        #endif
+    }
+
+#endif
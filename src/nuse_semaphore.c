@@ -10,6 +10,15 @@
 *   NUSE_Semaphore_Reset()
 *   NUSE_Semaphore_Information()
 *   NUSE_Semaphore_Count()
+*   NUSE_Binary_Semaphore_Obtain()
+*   NUSE_Binary_Semaphore_Release()
+*   NUSE_Binary_Semaphore_Count()
+*
+*   The width of the counting semaphore counters (8, 16 or 32 bits) is
+*   set by NUSE_SEMAPHORE_WIDTH
+*   Binary semaphores are held as one bit each in a single word, with a
+*   bit map of blocked tasks for each one, so that neither obtain nor
+*   release needs to count or to scan the task table
 *
 ************************************************************************/
 
@@ -42,6 +51,8 @@
 *       NUSE_UNAVAILABLE            the semaphore had the value 0 and could not, therefore, be obtained
 *       NUSE_INVALID_SEMAPHORE      specified semaphore index is invalid
 *       NUSE_INVALID_SUSPEND        task suspend option is not set to NUSE_NO_SUSPEND or NUSE_SUSPEND
+*       NUSE_DEADLOCK               blocking would have deadlocked the task [see nuse_deadlock.c];
+*                                   a semaphore with an initial value above 1 only records the cycle
 *
 *   OTHER OUTPUTS
 *
@@ -82,6 +93,7 @@
                 if (NUSE_Semaphore_Counter[semaphore] != 0)     /* semaphore available */
                 {
                     NUSE_Semaphore_Counter[semaphore]--;
+                    NUSE_DEADLOCK_HOLD(NUSE_Semaphore_Holders[semaphore]);
                     return_value = NUSE_SUCCESS;
                     suspend = NUSE_NO_SUSPEND;
                 }
@@ -93,6 +105,14 @@
                     }
                     else
                     {                                   /* block task */
+                        #if NUSE_DEADLOCK_DETECTION_SUPPORT
+                            if (NUSE_Deadlock_Check((semaphore << 4) | NUSE_SEMAPHORE_SUSPEND))
+                            {
+                                return_value = NUSE_DEADLOCK;
+                                suspend = NUSE_NO_SUSPEND;
+                                continue;
+                            }
+                        #endif
                         NUSE_Semaphore_Blocking_Count[semaphore]++;
                         NUSE_Suspend_Task(NUSE_Task_Active, (semaphore << 4) | NUSE_SEMAPHORE_SUSPEND);
                         return_value = NUSE_Task_Blocking_Return[NUSE_Task_Active];
@@ -107,6 +127,7 @@
             if (NUSE_Semaphore_Counter[semaphore] != 0)         /* semaphore available */
             {
                 NUSE_Semaphore_Counter[semaphore]--;
+                NUSE_DEADLOCK_HOLD(NUSE_Semaphore_Holders[semaphore]);
                 return_value = NUSE_SUCCESS;
             }
             else                                                /* semaphore unavailable */
@@ -131,7 +152,8 @@
 *
 *   DESCRIPTION
 *
-*       The specified semaphore is incremented, so long as its value was not initially 255
+*       The specified semaphore is incremented, so long as its value was not initially
+*       NUSE_SEMAPHORE_MAXIMUM [the largest value of the configured counter width]
 *
 *   INPUTS
 *
@@ -140,7 +162,7 @@
 *   RETURNS
 *
 *       NUSE_SUCCESS                the semaphore was successfully obtained
-*       NUSE_UNAVAILABLE            the semaphore had the value 255 and could not, therefore, be released
+*       NUSE_UNAVAILABLE            the semaphore had the value NUSE_SEMAPHORE_MAXIMUM and could not, therefore, be released
 *       NUSE_INVALID_SEMAPHORE      specified sempahore index is invalid
 *
 *   OTHER OUTPUTS
@@ -164,13 +186,21 @@
 
         NUSE_CS_Enter();
 
-        if (NUSE_Semaphore_Counter[semaphore] < 255)
+        if (NUSE_Semaphore_Counter[semaphore] != NUSE_SEMAPHORE_MAXIMUM)
         {
             NUSE_Semaphore_Counter[semaphore]++;
+            NUSE_DEADLOCK_DROP(NUSE_Semaphore_Holders[semaphore]);
             return_value = NUSE_SUCCESS;
 
             #if NUSE_BLOCKING_ENABLE
 
+                #if NUSE_TASK_WAIT_MULTIPLE || NUSE_INCLUDE_EVERYTHING
+                    if (NUSE_Multiple_Blocking_Count != 0)
+                    {
+                        NUSE_Wake_Multiple((semaphore << 4) | NUSE_SEMAPHORE_SUSPEND);
+                    }
+                #endif
+
                 if (NUSE_Semaphore_Blocking_Count[semaphore] != 0)
                 {
                     U8 index;                       /* check whether a task is blocked */
@@ -217,6 +247,7 @@
 *   INPUTS
 *
 *       NUSE_SEMPAHORE semaphore    index of semaphore to be reset
+*       NUSE_SEMAPHORE_COUNTER initial_count    new value for the semaphore counter
 *
 *   RETURNS
 *
@@ -231,7 +262,7 @@
 
 #if NUSE_SEMAPHORE_RESET || (NUSE_INCLUDE_EVERYTHING && (NUSE_SEMPAHORE_NUMBER != 0))
 
-    STATUS NUSE_Semaphore_Reset(NUSE_SEMAPHORE semaphore, U8 initial_count)
+    STATUS NUSE_Semaphore_Reset(NUSE_SEMAPHORE semaphore, NUSE_SEMAPHORE_COUNTER initial_count)
     {
         #if NUSE_API_PARAMETER_CHECKING
             if (semaphore >= NUSE_SEMAPHORE_NUMBER)
@@ -244,6 +275,10 @@
 
         NUSE_Semaphore_Counter[semaphore] = initial_count;
 
+        #if NUSE_DEADLOCK_DETECTION_SUPPORT
+            NUSE_Semaphore_Holders[semaphore] = 0;
+        #endif
+
         #if NUSE_BLOCKING_ENABLE
 
             while (NUSE_Semaphore_Blocking_Count[semaphore] != 0)
@@ -257,6 +292,8 @@
                         && (HINIB(NUSE_Task_Status[index]) == semaphore))
                     {
                         NUSE_Task_Blocking_Return[index] = NUSE_SEMAPHORE_WAS_RESET;
+                        NUSE_TRACE(NUSE_TRACE_WAKE, index, 0);
+                        NUSE_LATENCY_WAKE(index);
                         NUSE_Task_Status[index] = NUSE_READY;
                         break;
                     }
@@ -291,7 +328,7 @@
 *   INPUTS
 *
 *       NUSE_SEMAPHORE semaphore    index of semaphore about which information is required
-*       U8 *current_count           pointer to storage for the current semaphore count value
+*       NUSE_SEMAPHORE_COUNTER *current_count   pointer to storage for the current semaphore count value
 *       U8 *tasks_waiting           pointer to storage for number of waiting tasks [only used if blocking enable]
 *       NUSE_TASK *first_task       pointer to storage for pointer to first waiting task [only used if blocking enable]
 *
@@ -303,7 +340,7 @@
 *
 *   OTHER OUTPUTS
 *
-*       U8 *current_count           current semaphore count value
+*       NUSE_SEMAPHORE_COUNTER *current_count   current semaphore count value
 *       U8 *tasks_waiting           number of waiting tasks [if used, otherwise 0]
 *       NUSE_TASK *first_task       first waiting task [if used, otherwise 0]
 *
@@ -311,7 +348,7 @@
 
 #if NUSE_SEMAPHORE_INFORMATION || (NUSE_INCLUDE_EVERYTHING && (NUSE_SEMPAHORE_NUMBER != 0))
 
-    STATUS NUSE_Semaphore_Information(NUSE_SEMAPHORE semaphore, U8 *current_count, U8 *tasks_waiting, NUSE_TASK *first_task)
+    STATUS NUSE_Semaphore_Information(NUSE_SEMAPHORE semaphore, NUSE_SEMAPHORE_COUNTER *current_count, U8 *tasks_waiting, NUSE_TASK *first_task)
     {
         #if NUSE_API_PARAMETER_CHECKING
             if (semaphore >= NUSE_SEMAPHORE_NUMBER)
@@ -400,3 +437,231 @@
     }
 
 #endif
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Binary_Semaphore_Obtain()
+*
+*   DESCRIPTION
+*
+*       The specified binary semaphore is obtained, so long as it was available
+*       If the task blocks, ownership is passed to it directly by
+*       NUSE_Binary_Semaphore_Release(), so there is no retry on waking
+*
+*   INPUTS
+*
+*       NUSE_BINARY_SEMAPHORE semaphore     index of binary semaphore to be obtained
+*       U8 suspend                          task suspend option - must be NUSE_NO_SUSPEND or NUSE_SUSPEND
+*                                           depending upon the setting of NUSE_BLOCKING_ENABLE
+*
+*   RETURNS
+*
+*       NUSE_SUCCESS                the semaphore was successfully obtained
+*       NUSE_UNAVAILABLE            the semaphore was not available and could not, therefore, be obtained
+*       NUSE_INVALID_SEMAPHORE      specified semaphore index is invalid
+*       NUSE_INVALID_SUSPEND        task suspend option is not set to NUSE_NO_SUSPEND or NUSE_SUSPEND
+*       NUSE_DEADLOCK               blocking would have deadlocked the task [see nuse_deadlock.c]
+*
+*   OTHER OUTPUTS
+*
+*       (none)
+*
+*************************************************************************/
+
+#if NUSE_BINARY_SEMAPHORE_OBTAIN || (NUSE_INCLUDE_EVERYTHING && (NUSE_BINARY_SEMAPHORE_NUMBER != 0))
+
+    STATUS NUSE_Binary_Semaphore_Obtain(NUSE_BINARY_SEMAPHORE semaphore, U8 suspend)
+    {
+        STATUS return_value;
+        U16 mask;
+
+        #if NUSE_API_PARAMETER_CHECKING
+            if (semaphore >= NUSE_BINARY_SEMAPHORE_NUMBER)
+            {
+                return NUSE_INVALID_SEMAPHORE;
+            }
+
+            #if NUSE_BLOCKING_ENABLE
+                if ((suspend != NUSE_NO_SUSPEND) && (suspend != NUSE_SUSPEND))
+                {
+                    return NUSE_INVALID_SUSPEND;
+                }
+            #else
+                if (suspend != NUSE_NO_SUSPEND)
+                {
+                    return NUSE_INVALID_SUSPEND;
+                }
+            #endif
+        #endif
+
+        mask = (U16)1 << semaphore;
+
+        NUSE_CS_Enter();
+
+        if (NUSE_Binary_Semaphore_State & mask)         /* semaphore available */
+        {
+            NUSE_Binary_Semaphore_State &= ~mask;
+            NUSE_DEADLOCK_HOLD(NUSE_Binary_Semaphore_Holders[semaphore]);
+            return_value = NUSE_SUCCESS;
+        }
+        else                                            /* semaphore unavailable */
+        {
+            return_value = NUSE_UNAVAILABLE;
+
+            #if NUSE_BLOCKING_ENABLE
+                if (suspend == NUSE_SUSPEND)
+                {                                       /* block task */
+                    #if NUSE_DEADLOCK_DETECTION_SUPPORT
+                        if (NUSE_Deadlock_Check((semaphore << 4) | NUSE_BINARY_SUSPEND))
+                        {
+                            NUSE_CS_Exit();
+                            return NUSE_DEADLOCK;
+                        }
+                    #endif
+                    NUSE_Binary_Semaphore_Waiters[semaphore] |= (U16)1 << NUSE_Task_Active;
+                    NUSE_Suspend_Task(NUSE_Task_Active, (semaphore << 4) | NUSE_BINARY_SUSPEND);
+                    return_value = NUSE_Task_Blocking_Return[NUSE_Task_Active];
+                }
+            #endif
+        }
+
+        NUSE_CS_Exit();
+
+        return return_value;
+    }
+
+#endif
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Binary_Semaphore_Release()
+*
+*   DESCRIPTION
+*
+*       The specified binary semaphore is released, so long as it was not already available
+*       If any tasks are blocked on the semaphore, it is handed directly to the
+*       one with the lowest index [highest priority], which is found from the
+*       bit map of blocked tasks without scanning the task table
+*
+*   INPUTS
+*
+*       NUSE_BINARY_SEMAPHORE semaphore     index of binary semaphore to be released
+*
+*   RETURNS
+*
+*       NUSE_SUCCESS                the semaphore was successfully released
+*       NUSE_UNAVAILABLE            the semaphore was already available and could not, therefore, be released
+*       NUSE_INVALID_SEMAPHORE      specified semaphore index is invalid
+*
+*   OTHER OUTPUTS
+*
+*       (none)
+*
+*************************************************************************/
+
+#if NUSE_BINARY_SEMAPHORE_RELEASE || (NUSE_INCLUDE_EVERYTHING && (NUSE_BINARY_SEMAPHORE_NUMBER != 0))
+
+    STATUS NUSE_Binary_Semaphore_Release(NUSE_BINARY_SEMAPHORE semaphore)
+    {
+        STATUS return_value;
+        U16 mask;
+
+        #if NUSE_API_PARAMETER_CHECKING
+            if (semaphore >= NUSE_BINARY_SEMAPHORE_NUMBER)
+            {
+                return NUSE_INVALID_SEMAPHORE;
+            }
+        #endif
+
+        mask = (U16)1 << semaphore;
+
+        NUSE_CS_Enter();
+
+        #if NUSE_BLOCKING_ENABLE
+
+            if (NUSE_Binary_Semaphore_Waiters[semaphore] != 0)
+            {
+                U16 waiters;
+                NUSE_TASK task;                 /* pass the semaphore straight to */
+                                                /* the first blocked task */
+                waiters = NUSE_Binary_Semaphore_Waiters[semaphore];
+                for (task=0; !(waiters & 1); task++)
+                {
+                    waiters >>= 1;
+                }
+
+                NUSE_Binary_Semaphore_Waiters[semaphore] &= ~((U16)1 << task);
+                #if NUSE_DEADLOCK_DETECTION_SUPPORT
+                    NUSE_Binary_Semaphore_Holders[semaphore] = (U16)1 << task;
+                #endif
+                NUSE_Task_Blocking_Return[task] = NUSE_SUCCESS;
+                NUSE_Wake_Task(task);
+
+                NUSE_CS_Exit();
+
+                return NUSE_SUCCESS;
+            }
+
+        #endif
+
+        if (NUSE_Binary_Semaphore_State & mask)
+        {
+            return_value = NUSE_UNAVAILABLE;
+        }
+        else
+        {
+            NUSE_Binary_Semaphore_State |= mask;
+            #if NUSE_DEADLOCK_DETECTION_SUPPORT
+                NUSE_Binary_Semaphore_Holders[semaphore] = 0;
+            #endif
+            return_value = NUSE_SUCCESS;
+        }
+
+        NUSE_CS_Exit();
+
+        return return_value;
+    }
+
+#endif
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Binary_Semaphore_Count()
+*
+*   DESCRIPTION
+*
+*       Returns the number of binary semaphores in the system
+*       Code is trivial, as the number of binary semaphores is fixed in Nucleus SE,
+*       so a constant is returned
+*
+*   INPUTS
+*
+*       (none)
+*
+*   RETURNS
+*
+*       U8 value        number of binary semaphores in the system [Value: 0-15]
+*
+*   OTHER OUTPUTS
+*
+*       (none)
+*
+*************************************************************************/
+
+#if NUSE_BINARY_SEMAPHORE_COUNT || NUSE_INCLUDE_EVERYTHING
+
+    U8 NUSE_Binary_Semaphore_Count(void)
+    {
+        return NUSE_BINARY_SEMAPHORE_NUMBER;
+    }
+
+#endif
@@ -7,6 +7,7 @@
 *
 *   NUSE_Signals_Send()
 *   NUSE_Signals_Receive()
+*   NUSE_Signals_Wait()
 *
 ************************************************************************/
 
@@ -27,6 +28,8 @@
 *
 *       Sets one or more signals for the specified task
 *       A bit pattern [signals] is ORed into the signal buffer for the receiving task
+*       If that task is blocked in NUSE_Signals_Wait() and any signal in its mask
+*       is now set, it is woken
 *
 *   INPUTS
 *
@@ -59,7 +62,18 @@
         #endif
 
         NUSE_CS_Enter();
+
         NUSE_Task_Signal_Flags[task] |= signals;
+
+        #if (NUSE_SIGNALS_WAIT || NUSE_INCLUDE_EVERYTHING) && NUSE_BLOCKING_ENABLE
+            if ((NUSE_Task_Status[task] == NUSE_SIGNAL_SUSPEND)
+                && ((NUSE_Task_Signal_Flags[task] & NUSE_Task_Signal_Mask[task]) != 0))
+            {
+                NUSE_Task_Blocking_Return[task] = NUSE_SUCCESS;
+                NUSE_Wake_Task(task);
+            }
+        #endif
+
         NUSE_CS_Exit();
 
         return NUSE_SUCCESS;
@@ -107,3 +121,75 @@
     }
 
 #endif
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Signals_Wait()
+*
+*   DESCRIPTION
+*
+*       Obtains [destructive read] the signals for the current task which are
+*       selected by a bit pattern [mask]; other signals are left set
+*       If none of the selected signals is set, the task may block until
+*       NUSE_Signals_Send() sets one of them
+*
+*   INPUTS
+*
+*       U8 mask         bit pattern of signals to be waited for
+*       U8 suspend      task suspend option - must be NUSE_NO_SUSPEND or NUSE_SUSPEND
+*                       depending upon the setting of NUSE_BLOCKING_ENABLE
+*
+*   RETURNS
+*
+*       U8 value        selected signals value; 0 if none was set [without suspend],
+*                       if the mask is 0 or if the suspend option is invalid
+*
+*   OTHER OUTPUTS
+*
+*       (none)
+*
+*************************************************************************/
+
+#if NUSE_SIGNALS_WAIT || NUSE_INCLUDE_EVERYTHING
+
+    U8 NUSE_Signals_Wait(U8 mask, U8 suspend)
+    {
+        U8 signals;
+
+        #if NUSE_API_PARAMETER_CHECKING
+            #if NUSE_BLOCKING_ENABLE
+                if ((suspend != NUSE_NO_SUSPEND) && (suspend != NUSE_SUSPEND))
+                {
+                    return 0;
+                }
+            #else
+                if (suspend != NUSE_NO_SUSPEND)
+                {
+                    return 0;
+                }
+            #endif
+        #endif
+
+        NUSE_CS_Enter();
+
+        #if NUSE_BLOCKING_ENABLE
+            while ((suspend == NUSE_SUSPEND) && (mask != 0)
+                   && ((NUSE_Task_Signal_Flags[NUSE_Task_Active] & mask) == 0))
+            {                                                   /* block task */
+                NUSE_Task_Signal_Mask[NUSE_Task_Active] = mask;
+                NUSE_Suspend_Task(NUSE_Task_Active, NUSE_SIGNAL_SUSPEND);
+            }
+        #endif
+
+        signals = NUSE_Task_Signal_Flags[NUSE_Task_Active] & mask;
+        NUSE_Task_Signal_Flags[NUSE_Task_Active] &= ~mask;
+
+        NUSE_CS_Exit();
+
+        return signals;
+    }
+
+#endif
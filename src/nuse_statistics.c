@@ -0,0 +1,971 @@
+/*** Statistics APIs ***/
+
+/************************************************************************
+*
+*   This file contains the definitions of functions concerned with
+*   gathering run time statistics in Nucleus SE:
+*
+*   NUSE_Wait_Statistics()
+*   NUSE_Wait_Statistics_Reset()
+*   NUSE_CS_Profile_Site()
+*   NUSE_CS_Profile_Histogram()
+*   NUSE_CS_Profile_Reset()
+*   NUSE_Latency_Histogram()
+*   NUSE_Latency_Percentile()
+*   NUSE_Latency_Reset()
+*
+*   Wait statistics are kept for each queue, pipe, mailbox, semaphore, event
+*   group and partition pool; the blocking event is counted and the time
+*   until the task is resumed is measured in NUSE_Suspend_Task(), using
+*   NUSE_CYCLE_COUNTER() [in nuse_config.h]
+*   Peak occupancy of queues and pipes is recorded when an item is added
+*   Blocking in NUSE_Task_Wait_Multiple() is not attributed to any object
+*   The critical section profile records how long interrupts are masked by
+*   each NUSE_CS_Enter()/NUSE_CS_Exit() pair made in task context, both in a
+*   histogram and against the exit point of the critical section
+*   Latency histograms record the time from managed ISR entry until a task
+*   woken by the ISR is resumed, and from a task blocking until the next task
+*   is resumed; both are measured where a task resumes after NUSE_CONTEXT_SWAP()
+*   in NUSE_Reschedule(), so a task which is resuming from preemption, or
+*   starting from its entry point, is not measured
+*
+************************************************************************/
+
+#include "nuse_config.h"
+#include "nuse_codes.h"
+#include "nuse_types.h"
+#include "nuse_data.h"
+#include "nuse_prototypes.h"
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Wait_Statistics_Entry()
+*
+*   DESCRIPTION
+*
+*       Locates the statistics entry for an object
+*
+*   INPUTS
+*
+*       U8 object           object index and type, encoded as for NUSE_Task_Status
+*
+*   RETURNS
+*
+*       U8 value            index of the entry in the wait statistics arrays
+*                           or NUSE_NO_WAIT_STATISTICS if the object type or index is not valid
+*
+*   OTHER OUTPUTS
+*
+*       (none)
+*
+*************************************************************************/
+
+#if NUSE_WAIT_STATISTICS_SUPPORT
+
+    U8 NUSE_Wait_Statistics_Entry(U8 object)
+    {
+        U8 base, number;
+
+        switch (LONIB(object))
+        {
+            #if NUSE_QUEUE_NUMBER != 0
+                case NUSE_QUEUE_SUSPEND:
+                    base = NUSE_WAIT_STATISTICS_QUEUE;
+                    number = NUSE_QUEUE_NUMBER;
+                    break;
+            #endif
+            #if NUSE_PIPE_NUMBER != 0
+                case NUSE_PIPE_SUSPEND:
+                    base = NUSE_WAIT_STATISTICS_PIPE;
+                    number = NUSE_PIPE_NUMBER;
+                    break;
+            #endif
+            #if NUSE_MAILBOX_NUMBER != 0
+                case NUSE_MAILBOX_SUSPEND:
+                    base = NUSE_WAIT_STATISTICS_MAILBOX;
+                    number = NUSE_MAILBOX_NUMBER;
+                    break;
+            #endif
+            #if NUSE_SEMAPHORE_NUMBER != 0
+                case NUSE_SEMAPHORE_SUSPEND:
+                    base = NUSE_WAIT_STATISTICS_SEMAPHORE;
+                    number = NUSE_SEMAPHORE_NUMBER;
+                    break;
+            #endif
+            #if NUSE_EVENT_GROUP_NUMBER != 0
+                case NUSE_EVENT_SUSPEND:
+                    base = NUSE_WAIT_STATISTICS_EVENT_GROUP;
+                    number = NUSE_EVENT_GROUP_NUMBER;
+                    break;
+            #endif
+            #if NUSE_PARTITION_POOL_NUMBER != 0
+                case NUSE_PARTITION_SUSPEND:
+                    base = NUSE_WAIT_STATISTICS_PARTITION_POOL;
+                    number = NUSE_PARTITION_POOL_NUMBER;
+                    break;
+            #endif
+            default:
+                return NUSE_NO_WAIT_STATISTICS;
+        }
+
+        if (HINIB(object) >= number)
+        {
+            return NUSE_NO_WAIT_STATISTICS;
+        }
+
+        return base + HINIB(object);
+    }
+
+#endif
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Wait_Statistics_Block()
+*
+*   DESCRIPTION
+*
+*       Counts a blocking event on an object and updates the maximum number of
+*       tasks which have been blocked on it at once
+*       Called from NUSE_Suspend_Task(), in a critical section, once the status
+*       of the blocking task has been set
+*
+*   INPUTS
+*
+*       U8 object           object index and type, encoded as for NUSE_Task_Status
+*
+*   RETURNS
+*
+*       U8 value            index of the entry in the wait statistics arrays
+*                           or NUSE_NO_WAIT_STATISTICS if statistics are not kept for the object
+*
+*   OTHER OUTPUTS
+*
+*       (none)
+*
+*************************************************************************/
+
+#if NUSE_WAIT_STATISTICS_SUPPORT
+
+    U8 NUSE_Wait_Statistics_Block(U8 object)
+    {
+        U8 entry, index, waiters;
+
+        entry = NUSE_Wait_Statistics_Entry(object);
+        if (entry == NUSE_NO_WAIT_STATISTICS)
+        {
+            return NUSE_NO_WAIT_STATISTICS;
+        }
+
+        NUSE_Wait_Blocks[entry]++;
+
+        waiters = 0;
+        for (index=0; index<NUSE_TASK_NUMBER; index++)
+        {
+            if (NUSE_Task_Status[index] == object)
+            {
+                waiters++;
+            }
+        }
+
+        if (waiters > NUSE_Wait_Max_Waiters[entry])
+        {
+            NUSE_Wait_Max_Waiters[entry] = waiters;
+        }
+
+        return entry;
+    }
+
+#endif
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Wait_Statistics()
+*
+*   DESCRIPTION
+*
+*       Returns the blocking and wait time statistics for an object, gathered since
+*       initialization or NUSE_Wait_Statistics_Reset()
+*       The Information APIs give only a snapshot; these figures show how often tasks
+*       have stalled on an object and for how long
+*
+*   INPUTS
+*
+*       U8 object               object index and type - e.g. NUSE_WAIT_QUEUE(queue) [in nuse_codes.h]
+*       U16 *blocks             pointer to storage for the number of blocking events
+*       U8 *max_waiters         pointer to storage for the maximum number of blocked tasks
+*       U32 *total_time         pointer to storage for the cumulative blocked time
+*       U32 *max_time           pointer to storage for the longest blocked time
+*       U8 *peak_items          pointer to storage for the peak occupancy
+*
+*   RETURNS
+*
+*       NUSE_SUCCESS            the statistics were successfully returned
+*       NUSE_INVALID_OBJECT     the object type or index was not valid
+*       NUSE_INVALID_POINTER    one or more of the pointer parameters was NULL
+*
+*   OTHER OUTPUTS
+*
+*       U16 *blocks             number of times a task blocked on the object [wraps around]
+*       U8 *max_waiters         most tasks blocked on the object at once
+*       U32 *total_time         cumulative blocked time [in cycle counter units; wraps around]
+*       U32 *max_time           longest single blocked time [in cycle counter units]
+*       U8 *peak_items          most items held at once [queues and pipes; otherwise 0]
+*
+*************************************************************************/
+
+#if NUSE_WAIT_STATISTICS || (NUSE_INCLUDE_EVERYTHING && NUSE_WAIT_STATISTICS_SUPPORT)
+
+    STATUS NUSE_Wait_Statistics(U8 object, U16 *blocks, U8 *max_waiters, U32 *total_time, U32 *max_time, U8 *peak_items)
+    {
+        U8 entry;
+
+        entry = NUSE_Wait_Statistics_Entry(object);
+
+        #if NUSE_API_PARAMETER_CHECKING
+            if (entry == NUSE_NO_WAIT_STATISTICS)
+            {
+                return NUSE_INVALID_OBJECT;
+            }
+
+            if ((blocks == NULL) || (max_waiters == NULL) || (total_time == NULL) || (max_time == NULL) || (peak_items == NULL))
+            {
+                return NUSE_INVALID_POINTER;
+            }
+        #endif
+
+        NUSE_CS_Enter();
+
+        *blocks = NUSE_Wait_Blocks[entry];
+        *max_waiters = NUSE_Wait_Max_Waiters[entry];
+        *total_time = NUSE_Wait_Total_Time[entry];
+        *max_time = NUSE_Wait_Max_Time[entry];
+
+        switch (LONIB(object))
+        {
+            #if NUSE_QUEUE_NUMBER != 0
+                case NUSE_QUEUE_SUSPEND:
+                    *peak_items = NUSE_Queue_Peak[HINIB(object)];
+                    break;
+            #endif
+            #if NUSE_PIPE_NUMBER != 0
+                case NUSE_PIPE_SUSPEND:
+                    *peak_items = NUSE_Pipe_Peak[HINIB(object)];
+                    break;
+            #endif
+            default:
+                *peak_items = 0;
+                break;
+        }
+
+        NUSE_CS_Exit();
+
+        return NUSE_SUCCESS;
+    }
+
+#endif
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Wait_Statistics_Reset()
+*
+*   DESCRIPTION
+*
+*       Clears the wait statistics of every object, so that a fresh measurement
+*       interval is begun; peak occupancy restarts from the current item counts
+*
+*   INPUTS
+*
+*       (none)
+*
+*   RETURNS
+*
+*       (none)
+*
+*   OTHER OUTPUTS
+*
+*       (none)
+*
+*************************************************************************/
+
+#if NUSE_WAIT_STATISTICS_RESET || (NUSE_INCLUDE_EVERYTHING && NUSE_WAIT_STATISTICS_SUPPORT)
+
+    void NUSE_Wait_Statistics_Reset(void)
+    {
+        NUSE_CS_Enter();
+
+        NUSE_Init_Wait_Statistics();
+
+        NUSE_CS_Exit();
+    }
+
+#endif
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Histogram_Bucket()
+*
+*   DESCRIPTION
+*
+*       Selects the log2 scaled histogram bucket for a measured value
+*
+*   INPUTS
+*
+*       U32 value           measured value [in cycle counter units]
+*
+*   RETURNS
+*
+*       U8 value            index of the bucket [value: 0 to NUSE_HISTOGRAM_BUCKETS-1]
+*
+*   OTHER OUTPUTS
+*
+*       (none)
+*
+*************************************************************************/
+
+#if NUSE_CS_PROFILE_SUPPORT || NUSE_LATENCY_SUPPORT
+
+    U8 NUSE_Histogram_Bucket(U32 value)
+    {
+        U8 bucket;
+
+        bucket = 0;
+        while ((value > 1) && (bucket < (NUSE_HISTOGRAM_BUCKETS - 1)))
+        {
+            value >>= 1;
+            bucket++;
+        }
+
+        return bucket;
+    }
+
+#endif
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_CS_Profile_Enter()
+*
+*   DESCRIPTION
+*
+*       Records the start of a critical section
+*       Called by the NUSE_CS_Enter() macro [in nuse_types.h], once interrupts are masked
+*
+*   INPUTS
+*
+*       (none)
+*
+*   RETURNS
+*
+*       (none)
+*
+*   OTHER OUTPUTS
+*
+*       (none)
+*
+*************************************************************************/
+
+#if NUSE_CS_PROFILE_SUPPORT
+
+    void NUSE_CS_Profile_Enter(void)
+    {
+        NUSE_CS_Start = NUSE_CYCLE_COUNTER();
+    }
+
+#endif
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_CS_Profile_Exit()
+*
+*   DESCRIPTION
+*
+*       Records the duration of a critical section in the histogram and against
+*       the exit point, which is identified by source file and line number
+*       Called by the NUSE_CS_Exit() macro [in nuse_types.h], before interrupts are
+*       unmasked; the time taken here is not included in the duration
+*       If a task blocks within a critical section, the duration runs until the
+*       next task leaves its critical section, as interrupts stay masked meanwhile
+*       Once all NUSE_CS_PROFILE_SITES entries are in use, further exit points
+*       are only recorded in the histogram
+*
+*   INPUTS
+*
+*       char *file          source file name of the exit point [__FILE__]
+*       U16 line            source line number of the exit point [__LINE__]
+*
+*   RETURNS
+*
+*       (none)
+*
+*   OTHER OUTPUTS
+*
+*       (none)
+*
+*************************************************************************/
+
+#if NUSE_CS_PROFILE_SUPPORT
+
+    void NUSE_CS_Profile_Exit(char *file, U16 line)
+    {
+        U32 duration;
+        U8 site;
+
+        duration = NUSE_CYCLE_COUNTER() - NUSE_CS_Start;
+
+        NUSE_CS_Histogram[NUSE_Histogram_Bucket(duration)]++;
+        if (duration > NUSE_CS_Worst)
+        {
+            NUSE_CS_Worst = duration;
+        }
+
+        for (site=0; site<NUSE_CS_Sites_Used; site++)
+        {
+            if ((NUSE_CS_Site_Line[site] == line) && (NUSE_CS_Site_File[site] == file))
+            {
+                break;
+            }
+        }
+
+        if (site == NUSE_CS_Sites_Used)                 /* exit point not seen before */
+        {
+            if (site == NUSE_CS_PROFILE_SITES)
+            {
+                return;
+            }
+
+            NUSE_CS_Site_File[site] = file;
+            NUSE_CS_Site_Line[site] = line;
+            NUSE_CS_Site_Count[site] = 0;
+            NUSE_CS_Site_Worst[site] = 0;
+            NUSE_CS_Sites_Used++;
+        }
+
+        NUSE_CS_Site_Count[site]++;
+        if (duration > NUSE_CS_Site_Worst[site])
+        {
+            NUSE_CS_Site_Worst[site] = duration;
+        }
+    }
+
+#endif
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_CS_Profile_Site()
+*
+*   DESCRIPTION
+*
+*       Returns the profile of one critical section exit point
+*       Entries are allocated in the order in which exit points are first seen;
+*       an application may call this with site values from 0 until NUSE_INVALID_SITE
+*       is returned, to list all of them
+*
+*   INPUTS
+*
+*       U8 site                 index of the profile entry
+*       char **file             pointer to storage for the source file name
+*       U16 *line               pointer to storage for the source line number
+*       U16 *count              pointer to storage for the number of times the exit point was passed
+*       U32 *worst              pointer to storage for the longest duration
+*
+*   RETURNS
+*
+*       NUSE_SUCCESS            the profile entry was successfully returned
+*       NUSE_INVALID_SITE       the entry is not in use
+*       NUSE_INVALID_POINTER    one or more of the pointer parameters was NULL
+*
+*   OTHER OUTPUTS
+*
+*       char **file             source file name of the exit point
+*       U16 *line               source line number of the exit point
+*       U16 *count              number of critical sections ended there [wraps around]
+*       U32 *worst              longest critical section ended there [in cycle counter units]
+*
+*************************************************************************/
+
+#if NUSE_CS_PROFILE_SITE || (NUSE_INCLUDE_EVERYTHING && NUSE_CS_PROFILE_SUPPORT)
+
+    STATUS NUSE_CS_Profile_Site(U8 site, char **file, U16 *line, U16 *count, U32 *worst)
+    {
+        STATUS return_value;
+
+        #if NUSE_API_PARAMETER_CHECKING
+            if ((file == NULL) || (line == NULL) || (count == NULL) || (worst == NULL))
+            {
+                return NUSE_INVALID_POINTER;
+            }
+        #endif
+
+        NUSE_CS_Enter();
+
+        if (site >= NUSE_CS_Sites_Used)
+        {
+            return_value = NUSE_INVALID_SITE;
+        }
+        else
+        {
+            *file = NUSE_CS_Site_File[site];
+            *line = NUSE_CS_Site_Line[site];
+            *count = NUSE_CS_Site_Count[site];
+            *worst = NUSE_CS_Site_Worst[site];
+            return_value = NUSE_SUCCESS;
+        }
+
+        NUSE_CS_Exit();
+
+        return return_value;
+    }
+
+#endif
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_CS_Profile_Histogram()
+*
+*   DESCRIPTION
+*
+*       Returns the histogram of critical section durations for all exit points,
+*       together with the longest duration
+*
+*   INPUTS
+*
+*       U32 *counts             pointer to storage for NUSE_HISTOGRAM_BUCKETS counts
+*       U32 *worst              pointer to storage for the longest duration
+*
+*   RETURNS
+*
+*       NUSE_SUCCESS            the histogram was successfully returned
+*       NUSE_INVALID_POINTER    one or more of the pointer parameters was NULL
+*
+*   OTHER OUTPUTS
+*
+*       U32 *counts             number of critical sections in each bucket [see nuse_data.h]
+*       U32 *worst              longest critical section [in cycle counter units]
+*
+*************************************************************************/
+
+#if NUSE_CS_PROFILE_HISTOGRAM || (NUSE_INCLUDE_EVERYTHING && NUSE_CS_PROFILE_SUPPORT)
+
+    STATUS NUSE_CS_Profile_Histogram(U32 *counts, U32 *worst)
+    {
+        U8 bucket;
+
+        #if NUSE_API_PARAMETER_CHECKING
+            if ((counts == NULL) || (worst == NULL))
+            {
+                return NUSE_INVALID_POINTER;
+            }
+        #endif
+
+        NUSE_CS_Enter();
+
+        for (bucket=0; bucket<NUSE_HISTOGRAM_BUCKETS; bucket++)
+        {
+            counts[bucket] = NUSE_CS_Histogram[bucket];
+        }
+        *worst = NUSE_CS_Worst;
+
+        NUSE_CS_Exit();
+
+        return NUSE_SUCCESS;
+    }
+
+#endif
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_CS_Profile_Reset()
+*
+*   DESCRIPTION
+*
+*       Clears the critical section profile, so that a fresh measurement interval is begun
+*       The critical section in this function is the first one recorded afterwards
+*
+*   INPUTS
+*
+*       (none)
+*
+*   RETURNS
+*
+*       (none)
+*
+*   OTHER OUTPUTS
+*
+*       (none)
+*
+*************************************************************************/
+
+#if NUSE_CS_PROFILE_RESET || (NUSE_INCLUDE_EVERYTHING && NUSE_CS_PROFILE_SUPPORT)
+
+    void NUSE_CS_Profile_Reset(void)
+    {
+        NUSE_CS_Enter();
+
+        NUSE_Init_CS_Profile();
+
+        NUSE_CS_Exit();
+    }
+
+#endif
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Latency_ISR()
+*
+*   DESCRIPTION
+*
+*       Records the time of entry to a managed ISR
+*       The context of the interrupted task has just been saved by the ISR, so it will
+*       not resume in NUSE_Reschedule()
+*       Called by the NUSE_MANAGED_ISR() macro [in nuse_types.h]
+*
+*   INPUTS
+*
+*       (none)
+*
+*   RETURNS
+*
+*       (none)
+*
+*   OTHER OUTPUTS
+*
+*       (none)
+*
+*************************************************************************/
+
+#if NUSE_LATENCY_SUPPORT
+
+    void NUSE_Latency_ISR(void)
+    {
+        NUSE_Latency_ISR_Entry = NUSE_CYCLE_COUNTER();
+        NUSE_Latency_Resume_Hook &= ~((U16)1 << NUSE_Task_Active);
+    }
+
+#endif
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Latency_Swap_Out()
+*
+*   DESCRIPTION
+*
+*       Called by NUSE_Reschedule() immediately before the context swap
+*       The current task will resume after the swap; if it is blocking and the next task
+*       will also resume there, a block-to-switch measurement is started
+*
+*   INPUTS
+*
+*       (none)
+*
+*   RETURNS
+*
+*       (none)
+*
+*   OTHER OUTPUTS
+*
+*       (none)
+*
+*************************************************************************/
+
+#if NUSE_LATENCY_SUPPORT
+
+    void NUSE_Latency_Swap_Out(void)
+    {
+        NUSE_Latency_ISR_Woken &= ~((U16)1 << NUSE_Task_Active);  /* not resumed via NUSE_Reschedule() */
+        NUSE_Latency_Resume_Hook |= (U16)1 << NUSE_Task_Active;
+
+        NUSE_Latency_Switch_Pending = NUSE_Latency_Blocking
+            && (NUSE_Latency_Resume_Hook & ((U16)1 << NUSE_Task_Next));
+        NUSE_Latency_Blocking = FALSE;
+    }
+
+#endif
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Latency_Swap_In()
+*
+*   DESCRIPTION
+*
+*       Called by NUSE_Reschedule() when the current task has been resumed
+*       Completes a block-to-switch measurement, if one is pending, and an interrupt
+*       latency measurement, if the task was woken by an ISR
+*
+*   INPUTS
+*
+*       (none)
+*
+*   RETURNS
+*
+*       (none)
+*
+*   OTHER OUTPUTS
+*
+*       (none)
+*
+*************************************************************************/
+
+#if NUSE_LATENCY_SUPPORT
+
+    void NUSE_Latency_Swap_In(void)
+    {
+        U32 now, latency;
+
+        now = NUSE_CYCLE_COUNTER();
+
+        if (NUSE_Latency_Switch_Pending)
+        {
+            latency = now - NUSE_Latency_Block_Time;
+            NUSE_Latency_Counts[NUSE_SWITCH_LATENCY][NUSE_Histogram_Bucket(latency)]++;
+            if (latency > NUSE_Latency_Worst[NUSE_SWITCH_LATENCY])
+            {
+                NUSE_Latency_Worst[NUSE_SWITCH_LATENCY] = latency;
+            }
+            NUSE_Latency_Switch_Pending = FALSE;
+        }
+
+        if (NUSE_Latency_ISR_Woken & ((U16)1 << NUSE_Task_Active))
+        {
+            latency = now - NUSE_Task_Wake_Time[NUSE_Task_Active];
+            NUSE_Latency_Counts[NUSE_INTERRUPT_LATENCY][NUSE_Histogram_Bucket(latency)]++;
+            if (latency > NUSE_Latency_Worst[NUSE_INTERRUPT_LATENCY])
+            {
+                NUSE_Latency_Worst[NUSE_INTERRUPT_LATENCY] = latency;
+            }
+            NUSE_Latency_ISR_Woken &= ~((U16)1 << NUSE_Task_Active);
+        }
+    }
+
+#endif
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Latency_Histogram()
+*
+*   DESCRIPTION
+*
+*       Returns one of the latency histograms, together with the longest latency
+*
+*   INPUTS
+*
+*       U8 latency              measurement - NUSE_INTERRUPT_LATENCY or NUSE_SWITCH_LATENCY
+*       U32 *counts             pointer to storage for NUSE_HISTOGRAM_BUCKETS counts
+*       U32 *worst              pointer to storage for the longest latency
+*
+*   RETURNS
+*
+*       NUSE_SUCCESS            the histogram was successfully returned
+*       NUSE_INVALID_LATENCY    the measurement selection was not valid
+*       NUSE_INVALID_POINTER    one or more of the pointer parameters was NULL
+*
+*   OTHER OUTPUTS
+*
+*       U32 *counts             number of measurements in each bucket [see nuse_data.h]
+*       U32 *worst              longest latency [in cycle counter units]
+*
+*************************************************************************/
+
+#if NUSE_LATENCY_HISTOGRAM || (NUSE_INCLUDE_EVERYTHING && NUSE_LATENCY_SUPPORT)
+
+    STATUS NUSE_Latency_Histogram(U8 latency, U32 *counts, U32 *worst)
+    {
+        U8 bucket;
+
+        #if NUSE_API_PARAMETER_CHECKING
+            if ((latency != NUSE_INTERRUPT_LATENCY) && (latency != NUSE_SWITCH_LATENCY))
+            {
+                return NUSE_INVALID_LATENCY;
+            }
+
+            if ((counts == NULL) || (worst == NULL))
+            {
+                return NUSE_INVALID_POINTER;
+            }
+        #endif
+
+        NUSE_CS_Enter();
+
+        for (bucket=0; bucket<NUSE_HISTOGRAM_BUCKETS; bucket++)
+        {
+            counts[bucket] = NUSE_Latency_Counts[latency][bucket];
+        }
+        *worst = NUSE_Latency_Worst[latency];
+
+        NUSE_CS_Exit();
+
+        return NUSE_SUCCESS;
+    }
+
+#endif
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Latency_Percentile()
+*
+*   DESCRIPTION
+*
+*       Returns an upper bound for a percentile of one of the latency measurements
+*       - e.g. 50 for the median or 99 for the 99th percentile
+*       The bound is the top of the histogram bucket in which the percentile falls,
+*       so is within a factor of 2 of the true value; it never exceeds the longest latency
+*
+*   INPUTS
+*
+*       U8 latency              measurement - NUSE_INTERRUPT_LATENCY or NUSE_SWITCH_LATENCY
+*       U8 percent              percentile required [value: 1-100]
+*       U32 *bound              pointer to storage for the percentile bound
+*
+*   RETURNS
+*
+*       NUSE_SUCCESS            the percentile was successfully returned
+*       NUSE_INVALID_LATENCY    the measurement selection or percentile was not valid
+*       NUSE_INVALID_POINTER    the pointer parameter was NULL
+*
+*   OTHER OUTPUTS
+*
+*       U32 *bound              percentile bound [in cycle counter units; 0 if nothing has been measured]
+*
+*************************************************************************/
+
+#if NUSE_LATENCY_PERCENTILE || (NUSE_INCLUDE_EVERYTHING && NUSE_LATENCY_SUPPORT)
+
+    STATUS NUSE_Latency_Percentile(U8 latency, U8 percent, U32 *bound)
+    {
+        U32 counts[NUSE_HISTOGRAM_BUCKETS];
+        U32 worst, total, target;
+        U8 bucket;
+
+        #if NUSE_API_PARAMETER_CHECKING
+            if (((latency != NUSE_INTERRUPT_LATENCY) && (latency != NUSE_SWITCH_LATENCY))
+                || (percent == 0) || (percent > 100))
+            {
+                return NUSE_INVALID_LATENCY;
+            }
+
+            if (bound == NULL)
+            {
+                return NUSE_INVALID_POINTER;
+            }
+        #endif
+
+        NUSE_CS_Enter();
+
+        total = 0;
+        for (bucket=0; bucket<NUSE_HISTOGRAM_BUCKETS; bucket++)
+        {
+            counts[bucket] = NUSE_Latency_Counts[latency][bucket];
+            total += counts[bucket];
+        }
+        worst = NUSE_Latency_Worst[latency];
+
+        NUSE_CS_Exit();
+
+        if (total == 0)
+        {
+            *bound = 0;
+            return NUSE_SUCCESS;
+        }
+
+        target = (total / 100) * percent + ((total % 100) * percent + 99) / 100;
+
+        for (bucket=0; bucket<(NUSE_HISTOGRAM_BUCKETS - 1); bucket++)
+        {
+            if (counts[bucket] >= target)
+            {
+                break;
+            }
+            target -= counts[bucket];
+        }
+
+        *bound = ((U32)2 << bucket) - 1;
+        if ((bucket == (NUSE_HISTOGRAM_BUCKETS - 1)) || (*bound > worst))
+        {
+            *bound = worst;
+        }
+
+        return NUSE_SUCCESS;
+    }
+
+#endif
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Latency_Reset()
+*
+*   DESCRIPTION
+*
+*       Clears the latency histograms, so that a fresh measurement interval is begun
+*
+*   INPUTS
+*
+*       (none)
+*
+*   RETURNS
+*
+*       (none)
+*
+*   OTHER OUTPUTS
+*
+*       (none)
+*
+*************************************************************************/
+
+#if NUSE_LATENCY_RESET || (NUSE_INCLUDE_EVERYTHING && NUSE_LATENCY_SUPPORT)
+
+    void NUSE_Latency_Reset(void)
+    {
+        NUSE_CS_Enter();
+
+        NUSE_Init_Latency();
+
+        NUSE_CS_Exit();
+    }
+
+#endif
@@ -8,11 +8,16 @@
 *   NUSE_Task_Suspend()
 *   NUSE_Task_Resume()
 *   NUSE_Task_Sleep()
+*   NUSE_Task_Wait_Multiple()
 *   NUSE_Task_Reliquish()
 *   NUSE_Task_Current()
 *   NUSE_Task_Check_Stack()
+*   NUSE_Task_Stack_High_Water()
 *   NUSE_Task_Reset()
 *   NUSE_Task_Information()
+*   NUSE_Task_Runtime()
+*   NUSE_Task_Load()
+*   NUSE_Task_Runtime_Reset()
 *   NUSE_Task_Count()
 *
 ************************************************************************/
@@ -170,6 +175,167 @@
 #endif
 
 
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Task_Wait_Multiple()
+*
+*   DESCRIPTION
+*
+*       Waits until any one of a list of kernel objects is ready to be received from
+*       [queue or pipe not empty, mailbox full, semaphore available or event group
+*       flags satisfying the entry's request] and returns the position in the list
+*       of that object
+*       Each event group entry has requested flags and an operation, in the same
+*       positions of [events] and [operations], tested as by NUSE_Event_Group_Retrieve();
+*       these entries are ignored for other objects, and the pointers may be NULL if
+*       there are no event group entries
+*       The list is scanned in order, so earlier entries take precedence
+*       Nothing is received or obtained - the task should follow up with a
+*       NUSE_NO_SUSPEND call on the object; as another task may get there first,
+*       that call may fail, in which case the task should simply wait again
+*       Each list entry is built with one of the NUSE_WAIT_XXX() macros in nuse_codes.h,
+*       which use the same encoding as NUSE_Task_Status
+*
+*   INPUTS
+*
+*       U8 *objects             pointer to the list of objects to be waited on
+*       NUSE_EVENT_FLAGS *events    pointer to the list of requested flags for event group entries
+*       OPTION *operations      pointer to the list of operations for event group entries; may be:
+*                               NUSE_OR, NUSE_OR_CONSUME, NUSE_AND or NUSE_AND_CONSUME
+*                               [nothing is consumed until the follow-up call]
+*       U8 count                number of entries in the list
+*       U8 *ready               pointer to storage for the position of the ready object
+*       U8 suspend              task suspend option - must be NUSE_NO_SUSPEND or NUSE_SUSPEND
+*                               depending upon the setting of NUSE_BLOCKING_ENABLE
+*
+*   RETURNS
+*
+*       NUSE_SUCCESS            one of the objects is ready
+*       NUSE_UNAVAILABLE        none of the objects was ready
+*       NUSE_INVALID_POINTER    list pointer [objects] or ready pointer [ready] is NULL, or
+*                               [events] or [operations] is NULL with an event group entry
+*       NUSE_INVALID_SIZE       list size [count] is 0
+*       NUSE_INVALID_OBJECT     a list entry does not specify a configured queue, pipe,
+*                               mailbox, semaphore or event group
+*       NUSE_INVALID_OPERATION  the operation for an event group entry was not valid
+*       NUSE_INVALID_SUSPEND    task suspend option is not set to NUSE_NO_SUSPEND or NUSE_SUSPEND
+*
+*   OTHER OUTPUTS
+*
+*       U8 *ready               position in the list [from 0] of the ready object
+*
+*************************************************************************/
+
+#if NUSE_TASK_WAIT_MULTIPLE || NUSE_INCLUDE_EVERYTHING
+
+    STATUS NUSE_Task_Wait_Multiple(U8 *objects, NUSE_EVENT_FLAGS *events, OPTION *operations, U8 count, U8 *ready, U8 suspend)
+    {
+        STATUS return_value;
+        U8 index;
+
+        #if NUSE_EVENT_GROUP_NUMBER == 0
+            (void)events;                                   /* no event group entries */
+            (void)operations;
+        #endif
+
+        #if NUSE_API_PARAMETER_CHECKING
+            if ((objects == NULL) || (ready == NULL))
+            {
+                return NUSE_INVALID_POINTER;
+            }
+
+            if (count == 0)
+            {
+                return NUSE_INVALID_SIZE;
+            }
+
+            for (index=0; index<count; index++)
+            {
+                if (!NUSE_Valid_Object(objects[index]))
+                {
+                    return NUSE_INVALID_OBJECT;
+                }
+
+                #if NUSE_EVENT_GROUP_NUMBER != 0
+                    if (LONIB(objects[index]) == NUSE_EVENT_SUSPEND)
+                    {
+                        if ((events == NULL) || (operations == NULL))
+                        {
+                            return NUSE_INVALID_POINTER;
+                        }
+
+                        if ((operations[index] != NUSE_OR) && (operations[index] != NUSE_OR_CONSUME)
+                            && (operations[index] != NUSE_AND) && (operations[index] != NUSE_AND_CONSUME))
+                        {
+                            return NUSE_INVALID_OPERATION;
+                        }
+                    }
+                #endif
+            }
+
+            #if NUSE_BLOCKING_ENABLE
+                if ((suspend != NUSE_NO_SUSPEND) && (suspend != NUSE_SUSPEND))
+                {
+                    return NUSE_INVALID_SUSPEND;
+                }
+            #else
+                if (suspend != NUSE_NO_SUSPEND)
+                {
+                    return NUSE_INVALID_SUSPEND;
+                }
+            #endif
+        #endif
+
+        NUSE_CS_Enter();
+
+        NUSE_Task_Wait_List[NUSE_Task_Active] = objects;
+        #if NUSE_EVENT_GROUP_NUMBER != 0
+            NUSE_Task_Wait_Events[NUSE_Task_Active] = events;
+            NUSE_Task_Wait_Operations[NUSE_Task_Active] = operations;
+        #endif
+
+        do
+        {
+            return_value = NUSE_UNAVAILABLE;
+            for (index=0; index<count; index++)
+            {
+                if (NUSE_Object_Ready(NUSE_Task_Active, index))
+                {
+                    *ready = index;
+                    return_value = NUSE_SUCCESS;
+                    break;
+                }
+            }
+
+            if (return_value == NUSE_SUCCESS)
+            {
+                suspend = NUSE_NO_SUSPEND;
+            }
+            #if NUSE_BLOCKING_ENABLE
+                else if (suspend == NUSE_SUSPEND)                   /* block task */
+                {
+                    NUSE_Task_Wait_Count[NUSE_Task_Active] = count;
+                    NUSE_Multiple_Blocking_Count++;
+                    NUSE_Suspend_Task(NUSE_Task_Active, NUSE_MULTIPLE_SUSPEND);
+                    if (NUSE_Task_Blocking_Return[NUSE_Task_Active] != NUSE_SUCCESS)
+                    {
+                        return_value = NUSE_Task_Blocking_Return[NUSE_Task_Active];
+                        suspend = NUSE_NO_SUSPEND;
+                    }
+                }
+            #endif
+        } while (suspend == NUSE_SUSPEND);
+
+        NUSE_CS_Exit();
+
+        return return_value;
+    }
+
+#endif
+
+
 /*************************************************************************
 *
 *   FUNCTION
@@ -288,6 +454,85 @@
 #endif
 
 
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Task_Stack_High_Water()
+*
+*   DESCRIPTION
+*
+*       Returns the greatest amount of stack used by the specified task since it was
+*       initialized or reset
+*       Task stacks are filled with NUSE_STACK_PAINT_VALUE by NUSE_Init_Task(); the
+*       stack is scanned up from its base for the first word which has been overwritten
+*       If the base word has been overwritten, or the check at context switch has
+*       found it to be, the task has used all of its stack, and may have overflowed
+*
+*   INPUTS
+*
+*       NUSE_TASK task          index of task about which information is required
+*       U16 *high_water         pointer to storage for the stack usage
+*
+*   RETURNS
+*
+*       NUSE_SUCCESS            the stack usage was successfully returned
+*       NUSE_STACK_OVERFLOW     the task has used all of its stack
+*       NUSE_INVALID_TASK       the task index was not valid
+*       NUSE_INVALID_POINTER    the pointer parameter was NULL
+*
+*   OTHER OUTPUTS
+*
+*       U16 *high_water         maximum stack usage [in bytes]
+*
+*************************************************************************/
+
+#if NUSE_TASK_STACK_HIGH_WATER || (NUSE_INCLUDE_EVERYTHING && NUSE_STACK_PAINTING)
+
+    STATUS NUSE_Task_Stack_High_Water(NUSE_TASK task, U16 *high_water)
+    {
+        U16 unused;
+
+        #if NUSE_API_PARAMETER_CHECKING
+            if (task >= NUSE_TASK_NUMBER)
+            {
+                return NUSE_INVALID_TASK;
+            }
+
+            if (high_water == NULL)
+            {
+                return NUSE_INVALID_POINTER;
+            }
+        #endif
+
+        for (unused=0; unused<NUSE_Task_Stack_Size[task]; unused++)
+        {
+            if (((U32 *)NUSE_Task_Stack_Base[task])[unused] != NUSE_STACK_PAINT_VALUE)
+            {
+                break;
+            }
+        }
+
+        *high_water = (NUSE_Task_Stack_Size[task] - unused) * sizeof(U32);
+
+        #if NUSE_STACK_CHECK_SWITCH
+            if (NUSE_Task_Stack_Overflow & ((U16)1 << task))
+            {
+                return NUSE_STACK_OVERFLOW;
+            }
+        #endif
+
+        if (unused == 0)
+        {
+            return NUSE_STACK_OVERFLOW;
+        }
+
+        return NUSE_SUCCESS;
+    }
+
+#endif
+
+
 /*************************************************************************
 *
 *   FUNCTION
@@ -315,7 +560,7 @@
 *
 *************************************************************************/
 
-#if NUSE_TASK_RESET || NUSE_INCLUDE_EVERYTHING
+#if NUSE_TASK_RESET || NUSE_INCLUDE_EVERYTHING || NUSE_WATCHDOG_SUPPORT
 
     STATUS NUSE_Task_Reset(NUSE_TASK task)
     {
@@ -331,24 +576,56 @@
         #if NUSE_BLOCKING_ENABLE                        /* if task was blocked on API call */
             switch (LONIB(NUSE_Task_Status[task]))      /* need to update kernel object blocking info */
             {
-                case NUSE_MAILBOX_SUSPEND:
-                    NUSE_Mailbox_Blocking_Count[HINIB(NUSE_Task_Status[task])]--;
-                    break;
-                case NUSE_SEMAPHORE_SUSPEND:
-                    NUSE_Semaphore_Blocking_Count[HINIB(NUSE_Task_Status[task])]--;
-                    break;
-                case NUSE_PARTITION_SUSPEND:
-                    NUSE_Partition_Pool_Blocking_Count[HINIB(NUSE_Task_Status[task])]--;
-                    break;
-                case NUSE_QUEUE_SUSPEND:
-                    NUSE_Queue_Blocking_Count[HINIB(NUSE_Task_Status[task])]--;
-                    break;
-                case NUSE_PIPE_SUSPEND:
-                    NUSE_Pipe_Blocking_Count[HINIB(NUSE_Task_Status[task])]--;
-                    break;
-                case NUSE_EVENT_SUSPEND:
-                    NUSE_Event_Group_Blocking_Count[HINIB(NUSE_Task_Status[task])]--;
-                    break;
+                #if NUSE_MAILBOX_NUMBER != 0
+                    case NUSE_MAILBOX_SUSPEND:
+                        NUSE_Mailbox_Blocking_Count[HINIB(NUSE_Task_Status[task])]--;
+                        break;
+                #endif
+                #if NUSE_SEMAPHORE_NUMBER != 0
+                    case NUSE_SEMAPHORE_SUSPEND:
+                        NUSE_Semaphore_Blocking_Count[HINIB(NUSE_Task_Status[task])]--;
+                        break;
+                #endif
+                #if NUSE_PARTITION_POOL_NUMBER != 0
+                    case NUSE_PARTITION_SUSPEND:
+                        NUSE_Partition_Pool_Blocking_Count[HINIB(NUSE_Task_Status[task])]--;
+                        break;
+                #endif
+                #if NUSE_QUEUE_NUMBER != 0
+                    case NUSE_QUEUE_SUSPEND:
+                        NUSE_Queue_Blocking_Count[HINIB(NUSE_Task_Status[task])]--;
+                        break;
+                #endif
+                #if NUSE_PIPE_NUMBER != 0
+                    case NUSE_PIPE_SUSPEND:
+                        NUSE_Pipe_Blocking_Count[HINIB(NUSE_Task_Status[task])]--;
+                        break;
+                #endif
+                #if NUSE_EVENT_GROUP_NUMBER != 0
+                    case NUSE_EVENT_SUSPEND:
+                        NUSE_Event_Group_Blocking_Count[HINIB(NUSE_Task_Status[task])]--;
+                        break;
+                #endif
+                #if NUSE_CHANNEL_NUMBER != 0
+                    case NUSE_CHANNEL_SUSPEND:
+                        NUSE_Channel_Waiter[HINIB(NUSE_Task_Status[task])] = NUSE_NO_TASK;
+                        break;
+                #endif
+                #if NUSE_TASK_WAIT_MULTIPLE || NUSE_INCLUDE_EVERYTHING
+                    case NUSE_MULTIPLE_SUSPEND:
+                        NUSE_Multiple_Blocking_Count--;
+                        break;
+                #endif
+                #if NUSE_MEMORY_POOL_NUMBER != 0
+                    case NUSE_MEMORY_SUSPEND:
+                        NUSE_Memory_Pool_Blocking_Count[HINIB(NUSE_Task_Status[task])]--;
+                        break;
+                #endif
+                #if NUSE_BINARY_SEMAPHORE_NUMBER != 0
+                    case NUSE_BINARY_SUSPEND:
+                        NUSE_Binary_Semaphore_Waiters[HINIB(NUSE_Task_Status[task])] &= ~((U16)1 << task);
+                        break;
+                #endif
             }
         #endif
 
@@ -438,6 +715,207 @@
 #endif
 
 
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Task_Runtime()
+*
+*   DESCRIPTION
+*
+*       Returns the total time for which the specified task has run since
+*       it was initialized or reset, or since NUSE_Task_Runtime_Reset() was called
+*       Time is measured with NUSE_CYCLE_COUNTER() [in nuse_config.h] and is charged
+*       to the outgoing task at each context switch, so any time spent in ISRs is
+*       included in the figure for the task which was interrupted
+*       If the specified task is running, the current span is included
+*
+*   INPUTS
+*
+*       NUSE_TASK task          index of task about which information is required
+*       U32 *runtime            pointer to storage for the run time
+*
+*   RETURNS
+*
+*       NUSE_SUCCESS            the run time was successfully returned
+*       NUSE_INVALID_TASK       the task index was not valid
+*       NUSE_INVALID_POINTER    the pointer parameter was NULL
+*
+*   OTHER OUTPUTS
+*
+*       U32 *runtime            run time [in cycle counter units; wraps around]
+*
+*************************************************************************/
+
+#if NUSE_TASK_RUNTIME || (NUSE_INCLUDE_EVERYTHING && NUSE_RUNTIME_SUPPORT)
+
+    STATUS NUSE_Task_Runtime(NUSE_TASK task, U32 *runtime)
+    {
+        #if NUSE_API_PARAMETER_CHECKING
+            if (task >= NUSE_TASK_NUMBER)
+            {
+                return NUSE_INVALID_TASK;
+            }
+
+            if (runtime == NULL)
+            {
+                return NUSE_INVALID_POINTER;
+            }
+        #endif
+
+        NUSE_CS_Enter();
+
+        *runtime = NUSE_Task_Run_Time[task];
+        if (task == NUSE_Task_Active)
+        {
+            *runtime += NUSE_CYCLE_COUNTER() - NUSE_Run_Time_Switch;
+        }
+
+        NUSE_CS_Exit();
+
+        return NUSE_SUCCESS;
+    }
+
+#endif
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Task_Load()
+*
+*   DESCRIPTION
+*
+*       Returns the CPU load since run time accounting was started [by initialization
+*       or NUSE_Task_Runtime_Reset()]
+*       The load is the proportion of the elapsed time which was not spent in the
+*       specified idle task - normally the lowest priority task, which just loops
+*       The elapsed time must not exceed the range of the cycle counter
+*
+*   INPUTS
+*
+*       NUSE_TASK idle_task     index of the idle task
+*       U32 *elapsed            pointer to storage for the elapsed time
+*       U8 *load                pointer to storage for the CPU load
+*
+*   RETURNS
+*
+*       NUSE_SUCCESS            the load was successfully returned
+*       NUSE_INVALID_TASK       the task index was not valid
+*       NUSE_INVALID_POINTER    one or more of the pointer parameters was NULL
+*
+*   OTHER OUTPUTS
+*
+*       U32 *elapsed            elapsed time [in cycle counter units]
+*       U8 *load                CPU load [percent; value: 0-100]
+*
+*************************************************************************/
+
+#if NUSE_TASK_LOAD || (NUSE_INCLUDE_EVERYTHING && NUSE_RUNTIME_SUPPORT)
+
+    STATUS NUSE_Task_Load(NUSE_TASK idle_task, U32 *elapsed, U8 *load)
+    {
+        U32 now, total, idle;
+
+        #if NUSE_API_PARAMETER_CHECKING
+            if (idle_task >= NUSE_TASK_NUMBER)
+            {
+                return NUSE_INVALID_TASK;
+            }
+
+            if ((elapsed == NULL) || (load == NULL))
+            {
+                return NUSE_INVALID_POINTER;
+            }
+        #endif
+
+        NUSE_CS_Enter();
+
+        now = NUSE_CYCLE_COUNTER();
+        total = now - NUSE_Run_Time_Start;
+        idle = NUSE_Task_Run_Time[idle_task];
+        if (idle_task == NUSE_Task_Active)
+        {
+            idle += now - NUSE_Run_Time_Switch;
+        }
+
+        NUSE_CS_Exit();
+
+        *elapsed = total;
+
+        if (total == 0)
+        {
+            *load = 0;
+            return NUSE_SUCCESS;
+        }
+
+        if (total < 0x01000000UL)                       /* scale so that the product cannot overflow */
+        {
+            idle = (idle * 100) / total;
+        }
+        else
+        {
+            idle = idle / (total / 100);
+        }
+
+        if (idle > 100)
+        {
+            idle = 100;
+        }
+        *load = (U8)(100 - idle);
+
+        return NUSE_SUCCESS;
+    }
+
+#endif
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Task_Runtime_Reset()
+*
+*   DESCRIPTION
+*
+*       Clears the run time of every task and restarts the elapsed time used by
+*       NUSE_Task_Load(), so that a fresh measurement interval is begun
+*
+*   INPUTS
+*
+*       (none)
+*
+*   RETURNS
+*
+*       (none)
+*
+*   OTHER OUTPUTS
+*
+*       (none)
+*
+*************************************************************************/
+
+#if NUSE_TASK_RUNTIME_RESET || (NUSE_INCLUDE_EVERYTHING && NUSE_RUNTIME_SUPPORT)
+
+    void NUSE_Task_Runtime_Reset(void)
+    {
+        NUSE_TASK task;
+
+        NUSE_CS_Enter();
+
+        for (task=0; task<NUSE_TASK_NUMBER; task++)
+        {
+            NUSE_Task_Run_Time[task] = 0;
+        }
+        NUSE_Run_Time_Start = NUSE_Run_Time_Switch = NUSE_CYCLE_COUNTER();
+
+        NUSE_CS_Exit();
+    }
+
+#endif
+
+
 /*************************************************************************
 *
 *   FUNCTION
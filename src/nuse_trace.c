@@ -0,0 +1,142 @@
+/*** Trace recording ***/
+
+/************************************************************************
+*
+*   This file contains the definitions of functions concerned with
+*   recording events in the trace buffer in Nucleus SE:
+*
+*   NUSE_Trace_Entry()
+*   NUSE_Trace_Exit()
+*   NUSE_Trace_ISR()
+*
+*   The trace buffer is a ring of NUSE_TRACE_SIZE records of type U32, each
+*   holding a 16 bit time stamp, an event type, a task index and a byte of
+*   event data; once the ring is full, the oldest records are overwritten
+*   Kernel events are recorded by the NUSE_TRACE() macro [in nuse_data.h],
+*   at points which are already in a critical section or an ISR
+*   The functions here record events from application code - API service
+*   calls [via the macros in nuse_trace.h] and interrupts [via the ISR
+*   macros in nuse_types.h]
+*   The buffer and NUSE_Trace_Index may be read out with a debugger and
+*   converted to text with the host trace decoder [tools/nuse_trace_decode.c]
+*
+************************************************************************/
+
+#include "nuse_config.h"
+#include "nuse_codes.h"
+#include "nuse_types.h"
+#include "nuse_data.h"
+#include "nuse_prototypes.h"
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Trace_Entry()
+*
+*   DESCRIPTION
+*
+*       Records entry to an API service call made by the current task
+*
+*   INPUTS
+*
+*       U8 api                  identifier of the service call [as listed in nuse_trace.h]
+*
+*   RETURNS
+*
+*       (none)
+*
+*   OTHER OUTPUTS
+*
+*       (none)
+*
+*************************************************************************/
+
+#if NUSE_TRACE_API
+
+    void NUSE_Trace_Entry(U8 api)
+    {
+        NUSE_CS_Enter();
+        NUSE_TRACE(NUSE_TRACE_API_ENTRY, NUSE_Task_Active, api);
+        NUSE_CS_Exit();
+    }
+
+#endif
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Trace_Exit()
+*
+*   DESCRIPTION
+*
+*       Records exit from an API service call made by the current task, with its
+*       return value
+*       A task makes one call at a time, so the exit is matched to the call by the
+*       task's last NUSE_Trace_Entry() record
+*
+*   INPUTS
+*
+*       STATUS status           value returned by the service call
+*
+*   RETURNS
+*
+*       STATUS value            [status], unchanged
+*
+*   OTHER OUTPUTS
+*
+*       (none)
+*
+*************************************************************************/
+
+#if NUSE_TRACE_API
+
+    STATUS NUSE_Trace_Exit(STATUS status)
+    {
+        NUSE_CS_Enter();
+        NUSE_TRACE(NUSE_TRACE_API_EXIT, NUSE_Task_Active, status);
+        NUSE_CS_Exit();
+
+        return status;
+    }
+
+#endif
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Trace_ISR()
+*
+*   DESCRIPTION
+*
+*       Records entry to or exit from an ISR, with the task which was interrupted
+*       Called from the ISR macros in nuse_types.h, after NUSE_Task_State has been
+*       set to the ISR context, which is recorded as the event data
+*
+*   INPUTS
+*
+*       U8 event                NUSE_TRACE_ISR_ENTRY or NUSE_TRACE_ISR_EXIT
+*
+*   RETURNS
+*
+*       (none)
+*
+*   OTHER OUTPUTS
+*
+*       (none)
+*
+*************************************************************************/
+
+#if NUSE_TRACE_SUPPORT
+
+    void NUSE_Trace_ISR(U8 event)
+    {
+        NUSE_TRACE(event, NUSE_Task_Active, NUSE_Task_State);
+    }
+
+#endif
@@ -0,0 +1,119 @@
+/*************************************************************************
+*
+*   This file contains the macros which record the entry to and exit from
+*   API service calls in the trace buffer, if NUSE_TRACE_API is enabled
+*
+*   Each call made by the application is replaced by a call of
+*   NUSE_Trace_Entry(), then the service call itself, with its return value
+*   passed through NUSE_Trace_Exit(); calls made within the kernel are not
+*   recorded
+*   The identifiers [1-42] are also used by the host trace decoder, so the
+*   two lists must be kept in step
+*
+*************************************************************************/
+
+/* Check to see if the file has been included already.  */
+#ifndef _NUSE_TRACE_H_
+#define _NUSE_TRACE_H_
+
+#if NUSE_TRACE_API
+
+    #define NUSE_Task_Suspend(task) \
+        (NUSE_Trace_Entry(1), NUSE_Trace_Exit(NUSE_Task_Suspend(task)))
+    #define NUSE_Task_Resume(task) \
+        (NUSE_Trace_Entry(2), NUSE_Trace_Exit(NUSE_Task_Resume(task)))
+    #define NUSE_Task_Sleep(ticks) \
+        ((void)(NUSE_Trace_Entry(3), NUSE_Task_Sleep(ticks), NUSE_Trace_Exit(NUSE_SUCCESS)))
+    #define NUSE_Task_Wait_Multiple(objects, events, operations, count, ready, suspend) \
+        (NUSE_Trace_Entry(4), NUSE_Trace_Exit(NUSE_Task_Wait_Multiple(objects, events, operations, count, ready, suspend)))
+    #define NUSE_Task_Relinquish() \
+        ((void)(NUSE_Trace_Entry(5), NUSE_Task_Relinquish(), NUSE_Trace_Exit(NUSE_SUCCESS)))
+    #define NUSE_Task_Reset(task) \
+        (NUSE_Trace_Entry(6), NUSE_Trace_Exit(NUSE_Task_Reset(task)))
+
+    #define NUSE_Partition_Allocate(pool, return_pointer, suspend) \
+        (NUSE_Trace_Entry(7), NUSE_Trace_Exit(NUSE_Partition_Allocate(pool, return_pointer, suspend)))
+    #define NUSE_Partition_Allocate_Size(size, return_pointer) \
+        (NUSE_Trace_Entry(8), NUSE_Trace_Exit(NUSE_Partition_Allocate_Size(size, return_pointer)))
+    #define NUSE_Partition_Deallocate(partition) \
+        (NUSE_Trace_Entry(9), NUSE_Trace_Exit(NUSE_Partition_Deallocate(partition)))
+    #define NUSE_Partition_Reference(partition) \
+        (NUSE_Trace_Entry(10), NUSE_Trace_Exit(NUSE_Partition_Reference(partition)))
+    #define NUSE_Partition_Send(partition, queues, count, sent) \
+        (NUSE_Trace_Entry(11), NUSE_Trace_Exit(NUSE_Partition_Send(partition, queues, count, sent)))
+
+    #define NUSE_Memory_Allocate(pool, return_pointer, size, suspend) \
+        (NUSE_Trace_Entry(12), NUSE_Trace_Exit(NUSE_Memory_Allocate(pool, return_pointer, size, suspend)))
+    #define NUSE_Memory_Deallocate(memory) \
+        (NUSE_Trace_Entry(13), NUSE_Trace_Exit(NUSE_Memory_Deallocate(memory)))
+
+    #define NUSE_Mailbox_Send(mailbox, message, suspend) \
+        (NUSE_Trace_Entry(14), NUSE_Trace_Exit(NUSE_Mailbox_Send(mailbox, message, suspend)))
+    #define NUSE_Mailbox_Overwrite(mailbox, message) \
+        (NUSE_Trace_Entry(15), NUSE_Trace_Exit(NUSE_Mailbox_Overwrite(mailbox, message)))
+    #define NUSE_Mailbox_Receive(mailbox, message, suspend) \
+        (NUSE_Trace_Entry(16), NUSE_Trace_Exit(NUSE_Mailbox_Receive(mailbox, message, suspend)))
+    #define NUSE_Mailbox_Reset(mailbox) \
+        (NUSE_Trace_Entry(17), NUSE_Trace_Exit(NUSE_Mailbox_Reset(mailbox)))
+
+    #define NUSE_Queue_Send(queue, message, suspend) \
+        (NUSE_Trace_Entry(18), NUSE_Trace_Exit(NUSE_Queue_Send(queue, message, suspend)))
+    #define NUSE_Queue_Receive(queue, message, suspend) \
+        (NUSE_Trace_Entry(19), NUSE_Trace_Exit(NUSE_Queue_Receive(queue, message, suspend)))
+    #define NUSE_Queue_Jam(queue, message, suspend) \
+        (NUSE_Trace_Entry(20), NUSE_Trace_Exit(NUSE_Queue_Jam(queue, message, suspend)))
+    #define NUSE_Queue_Broadcast(queue, message, suspend) \
+        (NUSE_Trace_Entry(21), NUSE_Trace_Exit(NUSE_Queue_Broadcast(queue, message, suspend)))
+    #define NUSE_Queue_Reset(queue) \
+        (NUSE_Trace_Entry(22), NUSE_Trace_Exit(NUSE_Queue_Reset(queue)))
+
+    #define NUSE_Pipe_Send(pipe, message, size, suspend) \
+        (NUSE_Trace_Entry(23), NUSE_Trace_Exit(NUSE_Pipe_Send(pipe, message, size, suspend)))
+    #define NUSE_Pipe_Receive(pipe, message, size, actual_size, suspend) \
+        (NUSE_Trace_Entry(24), NUSE_Trace_Exit(NUSE_Pipe_Receive(pipe, message, size, actual_size, suspend)))
+    #define NUSE_Pipe_Jam(pipe, message, size, suspend) \
+        (NUSE_Trace_Entry(25), NUSE_Trace_Exit(NUSE_Pipe_Jam(pipe, message, size, suspend)))
+    #define NUSE_Pipe_Broadcast(pipe, message, size, suspend) \
+        (NUSE_Trace_Entry(26), NUSE_Trace_Exit(NUSE_Pipe_Broadcast(pipe, message, size, suspend)))
+    #define NUSE_Pipe_Reset(pipe) \
+        (NUSE_Trace_Entry(27), NUSE_Trace_Exit(NUSE_Pipe_Reset(pipe)))
+
+    #define NUSE_Channel_Put(channel, message) \
+        (NUSE_Trace_Entry(28), NUSE_Trace_Exit(NUSE_Channel_Put(channel, message)))
+    #define NUSE_Channel_Get(channel, message, suspend) \
+        (NUSE_Trace_Entry(29), NUSE_Trace_Exit(NUSE_Channel_Get(channel, message, suspend)))
+
+    #define NUSE_Board_Write(board, data, size) \
+        (NUSE_Trace_Entry(30), NUSE_Trace_Exit(NUSE_Board_Write(board, data, size)))
+    #define NUSE_Board_Read(board, data, size) \
+        (NUSE_Trace_Entry(31), NUSE_Trace_Exit(NUSE_Board_Read(board, data, size)))
+
+    #define NUSE_Semaphore_Obtain(semaphore, suspend) \
+        (NUSE_Trace_Entry(32), NUSE_Trace_Exit(NUSE_Semaphore_Obtain(semaphore, suspend)))
+    #define NUSE_Semaphore_Release(semaphore) \
+        (NUSE_Trace_Entry(33), NUSE_Trace_Exit(NUSE_Semaphore_Release(semaphore)))
+    #define NUSE_Semaphore_Reset(semaphore, initial_count) \
+        (NUSE_Trace_Entry(34), NUSE_Trace_Exit(NUSE_Semaphore_Reset(semaphore, initial_count)))
+    #define NUSE_Binary_Semaphore_Obtain(semaphore, suspend) \
+        (NUSE_Trace_Entry(35), NUSE_Trace_Exit(NUSE_Binary_Semaphore_Obtain(semaphore, suspend)))
+    #define NUSE_Binary_Semaphore_Release(semaphore) \
+        (NUSE_Trace_Entry(36), NUSE_Trace_Exit(NUSE_Binary_Semaphore_Release(semaphore)))
+
+    #define NUSE_Event_Group_Set(group, event_flags, operation) \
+        (NUSE_Trace_Entry(37), NUSE_Trace_Exit(NUSE_Event_Group_Set(group, event_flags, operation)))
+    #define NUSE_Event_Group_Retrieve(group, requested_events, operation, retrieved_events, suspend) \
+        (NUSE_Trace_Entry(38), NUSE_Trace_Exit(NUSE_Event_Group_Retrieve(group, requested_events, operation, retrieved_events, suspend)))
+
+    #define NUSE_Signals_Send(task, signals) \
+        (NUSE_Trace_Entry(39), NUSE_Trace_Exit(NUSE_Signals_Send(task, signals)))
+    #define NUSE_Signals_Wait(mask, suspend) \
+        ((U8)(NUSE_Trace_Entry(40), NUSE_Trace_Exit((STATUS)NUSE_Signals_Wait(mask, suspend))))
+
+    #define NUSE_Timer_Control(timer, enable) \
+        (NUSE_Trace_Entry(41), NUSE_Trace_Exit(NUSE_Timer_Control(timer, enable)))
+    #define NUSE_Timer_Reset(timer, enable) \
+        (NUSE_Trace_Entry(42), NUSE_Trace_Exit(NUSE_Timer_Reset(timer, enable)))
+
+#endif
+
+#endif  /* ! _NUSE_TRACE_H_ */
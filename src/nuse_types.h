@@ -15,6 +15,8 @@
 #ifndef _NUSE_TYPES_H_
 #define _NUSE_TYPES_H_
 
+#include "nuse_config.h"
+
 
 /* Data types used by Nucleus SE - these may need to be adjusted for different compilers/CPUs */
 
@@ -29,13 +31,41 @@ typedef U8 OPTION;              /* service call option parameter value */
 
 typedef U8 NUSE_TASK;           /* kernel object index data types */
 typedef U8 NUSE_PARTITION_POOL;
+typedef U8 NUSE_MEMORY_POOL;
 typedef U8 NUSE_MAILBOX;
 typedef U8 NUSE_QUEUE;
 typedef U8 NUSE_PIPE;
+typedef U8 NUSE_CHANNEL;
+typedef U8 NUSE_BOARD;
 typedef U8 NUSE_SEMAPHORE;
+typedef U8 NUSE_BINARY_SEMAPHORE;
 typedef U8 NUSE_EVENT_GROUP;
 typedef U8 NUSE_TIMER;
 
+#if NUSE_EVENT_GROUP_WIDTH == 32    /* event flags data type follows the configured group width */
+    typedef U32 NUSE_EVENT_FLAGS;
+#elif NUSE_EVENT_GROUP_WIDTH == 16
+    typedef U16 NUSE_EVENT_FLAGS;
+#else
+    typedef U8 NUSE_EVENT_FLAGS;
+#endif
+
+#if NUSE_SEMAPHORE_WIDTH == 32      /* semaphore counter data type follows the configured width */
+    typedef U32 NUSE_SEMAPHORE_COUNTER;
+#elif NUSE_SEMAPHORE_WIDTH == 16
+    typedef U16 NUSE_SEMAPHORE_COUNTER;
+#else
+    typedef U8 NUSE_SEMAPHORE_COUNTER;
+#endif
+
+#define NUSE_SEMAPHORE_MAXIMUM ((NUSE_SEMAPHORE_COUNTER)~0)
+
+#if NUSE_PARTITION_COUNT_WIDTH == 16    /* partition count data type follows the configured width */
+    typedef U16 NUSE_PARTITION_COUNT;
+#else
+    typedef U8 NUSE_PARTITION_COUNT;
+#endif
+
 #define TRUE (1)
 #define FALSE (0)
 
@@ -55,15 +85,36 @@ typedef void (*PF2)(U8, ADDR);
 
 /*** CPU specfics ***/
 
-/* Critical section delimiters */
+/* Critical section delimiters - if profiling is configured, the time for which */
+/* interrupts are masked is recorded against the exit point */
+
+#if NUSE_CS_PROFILE_SUPPORT
+
+    #define NUSE_CS_Enter()                             \
+        if (NUSE_Task_State == NUSE_TASK_CONTEXT)       \
+        {                                               \
+            asm(" move.w #$2700,sr");                   \
+            NUSE_CS_Profile_Enter();                    \
+        }
+
+    #define NUSE_CS_Exit()                              \
+        if (NUSE_Task_State == NUSE_TASK_CONTEXT)       \
+        {                                               \
+            NUSE_CS_Profile_Exit(__FILE__, __LINE__);   \
+            asm(" move.w #$2000,sr");                   \
+        }
 
-#define NUSE_CS_Enter()                 \
-    if (NUSE_Task_State == NUSE_TASK_CONTEXT)   \
-        asm(" move.w #$2700,sr");
+#else
 
-#define NUSE_CS_Exit()                  \
-    if (NUSE_Task_State == NUSE_TASK_CONTEXT)   \
-        asm(" move.w #$2000,sr");
+    #define NUSE_CS_Enter()                 \
+        if (NUSE_Task_State == NUSE_TASK_CONTEXT)   \
+            asm(" move.w #$2700,sr");
+
+    #define NUSE_CS_Exit()                  \
+        if (NUSE_Task_State == NUSE_TASK_CONTEXT)   \
+            asm(" move.w #$2000,sr");
+
+#endif
 
 #define NUSE_REGISTERS          18
 #define NUSE_STATUS_REGISTER    ((ADDR)0x40002000)
@@ -73,14 +124,28 @@ typedef void (*PF2)(U8, ADDR);
 
 /* Interrupt Service Routine Support */
 
+#if NUSE_TRACE_SUPPORT
+    #define NUSE_TRACE_ISR(event) NUSE_Trace_ISR(event);
+#else
+    #define NUSE_TRACE_ISR(event)
+#endif
+
+#if NUSE_LATENCY_SUPPORT
+    #define NUSE_LATENCY_ISR() NUSE_Latency_ISR();
+#else
+    #define NUSE_LATENCY_ISR()
+#endif
+
 /* Native interrupts */
 
 #define NUSE_NISR_Enter() \
 static U8 NUSE_Old_Task_State; \
 NUSE_Old_Task_State = NUSE_Task_State; \
-NUSE_Task_State = NUSE_NISR_CONTEXT;
+NUSE_Task_State = NUSE_NISR_CONTEXT; \
+NUSE_TRACE_ISR(NUSE_TRACE_ISR_ENTRY)
 
 #define NUSE_NISR_Exit() \
+NUSE_TRACE_ISR(NUSE_TRACE_ISR_EXIT) \
 NUSE_Task_State = NUSE_Old_Task_State;
 
 /* Managed interrupts */
@@ -109,7 +174,10 @@ asm(" move.l (sp)+,(a0)+"); \
 asm(" move.l sp,(a0)"); \
 NUSE_Task_Saved_State = NUSE_Task_State; \
 NUSE_Task_State = NUSE_MISR_CONTEXT; \
+NUSE_LATENCY_ISR() \
+NUSE_TRACE_ISR(NUSE_TRACE_ISR_ENTRY) \
 isrcode(); \
+NUSE_TRACE_ISR(NUSE_TRACE_ISR_EXIT) \
 NUSE_Task_State = NUSE_Task_Saved_State; \
 asm(" lea _NUSE_Task_Context,a0"); \
 asm(" clr d0"); \
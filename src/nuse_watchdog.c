@@ -0,0 +1,391 @@
+/*** Task watchdog APIs ***/
+
+/************************************************************************
+*
+*   This file contains the definitions of functions concerned with the
+*   task liveness watchdog in Nucleus SE:
+*
+*   NUSE_Watchdog_Start()
+*   NUSE_Watchdog_Check_In()
+*   NUSE_Watchdog_Stop()
+*
+*   Each watched task must call NUSE_Watchdog_Check_In() within its period
+*   The watched tasks are kept in a delta list, in deadline order; each
+*   entry holds the number of ticks after the one before it, so the clock
+*   ISR only decrements the entry at the head
+*   When a check-in is missed, the watch is stopped and NUSE_WATCHDOG_HANDLER()
+*   [in nuse_config.h] is called from the clock ISR; the default handler,
+*   NUSE_Watchdog_Reset(), resets the task with NUSE_Task_Reset() and
+*   restarts it from its entry point, where it will start its watch again
+*
+************************************************************************/
+
+#include "nuse_config.h"
+#include "nuse_codes.h"
+#include "nuse_types.h"
+#include "nuse_data.h"
+#include "nuse_prototypes.h"
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Watchdog_Start()
+*
+*   DESCRIPTION
+*
+*       Starts [or restarts] watching the specified task, which must then check
+*       in within the given period; the first period starts now
+*
+*   INPUTS
+*
+*       NUSE_TASK task          index of task to be watched
+*       U16 period              maximum interval between check-ins [ticks]
+*
+*   RETURNS
+*
+*       NUSE_SUCCESS            the watch was successfully started
+*       NUSE_INVALID_TASK       the task index was not valid
+*       NUSE_INVALID_PERIOD     the period was 0
+*
+*   OTHER OUTPUTS
+*
+*       (none)
+*
+*************************************************************************/
+
+#if NUSE_WATCHDOG_START || (NUSE_INCLUDE_EVERYTHING && NUSE_WATCHDOG_SUPPORT)
+
+    STATUS NUSE_Watchdog_Start(NUSE_TASK task, U16 period)
+    {
+        #if NUSE_API_PARAMETER_CHECKING
+            if (task >= NUSE_TASK_NUMBER)
+            {
+                return NUSE_INVALID_TASK;
+            }
+
+            if (period == 0)
+            {
+                return NUSE_INVALID_PERIOD;
+            }
+        #endif
+
+        NUSE_CS_Enter();
+
+        if (NUSE_Watchdog_Period[task] != 0)
+        {
+            NUSE_Watchdog_Remove(task);
+        }
+        NUSE_Watchdog_Period[task] = period;
+        NUSE_Watchdog_Insert(task);
+
+        NUSE_CS_Exit();
+
+        return NUSE_SUCCESS;
+    }
+
+#endif
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Watchdog_Check_In()
+*
+*   DESCRIPTION
+*
+*       Called by a watched task to show that it is alive
+*       Its deadline is moved to one period from now
+*
+*   INPUTS
+*
+*       (none)
+*
+*   RETURNS
+*
+*       NUSE_SUCCESS            the check-in was successful
+*       NUSE_UNAVAILABLE        the current task is not being watched
+*
+*   OTHER OUTPUTS
+*
+*       (none)
+*
+*************************************************************************/
+
+#if NUSE_WATCHDOG_CHECK_IN || (NUSE_INCLUDE_EVERYTHING && NUSE_WATCHDOG_SUPPORT)
+
+    STATUS NUSE_Watchdog_Check_In(void)
+    {
+        STATUS return_value;
+
+        NUSE_CS_Enter();
+
+        if (NUSE_Watchdog_Period[NUSE_Task_Active] != 0)
+        {
+            NUSE_Watchdog_Remove(NUSE_Task_Active);
+            NUSE_Watchdog_Insert(NUSE_Task_Active);
+            return_value = NUSE_SUCCESS;
+        }
+        else
+        {
+            return_value = NUSE_UNAVAILABLE;
+        }
+
+        NUSE_CS_Exit();
+
+        return return_value;
+    }
+
+#endif
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Watchdog_Stop()
+*
+*   DESCRIPTION
+*
+*       Stops watching the specified task
+*
+*   INPUTS
+*
+*       NUSE_TASK task          index of task
+*
+*   RETURNS
+*
+*       NUSE_SUCCESS            the watch was successfully stopped
+*       NUSE_INVALID_TASK       the task index was not valid
+*       NUSE_UNAVAILABLE        the task was not being watched
+*
+*   OTHER OUTPUTS
+*
+*       (none)
+*
+*************************************************************************/
+
+#if NUSE_WATCHDOG_STOP || (NUSE_INCLUDE_EVERYTHING && NUSE_WATCHDOG_SUPPORT)
+
+    STATUS NUSE_Watchdog_Stop(NUSE_TASK task)
+    {
+        STATUS return_value;
+
+        #if NUSE_API_PARAMETER_CHECKING
+            if (task >= NUSE_TASK_NUMBER)
+            {
+                return NUSE_INVALID_TASK;
+            }
+        #endif
+
+        NUSE_CS_Enter();
+
+        if (NUSE_Watchdog_Period[task] != 0)
+        {
+            NUSE_Watchdog_Remove(task);
+            NUSE_Watchdog_Period[task] = 0;
+            return_value = NUSE_SUCCESS;
+        }
+        else
+        {
+            return_value = NUSE_UNAVAILABLE;
+        }
+
+        NUSE_CS_Exit();
+
+        return return_value;
+    }
+
+#endif
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Watchdog_Insert()
+*
+*   DESCRIPTION
+*
+*       Places a task in the delta list, one period from now
+*       Must be called in a critical section, with the task not in the list
+*
+*   INPUTS
+*
+*       NUSE_TASK task          index of task
+*
+*   RETURNS
+*
+*       (none)
+*
+*   OTHER OUTPUTS
+*
+*       (none)
+*
+*************************************************************************/
+
+#if NUSE_WATCHDOG_SUPPORT
+
+    void NUSE_Watchdog_Insert(NUSE_TASK task)
+    {
+        NUSE_TASK *link;
+        U16 delta;
+
+        delta = NUSE_Watchdog_Period[task];
+        link = &NUSE_Watchdog_Head;
+        while ((*link != NUSE_NO_TASK) && (NUSE_Watchdog_Delta[*link] <= delta))
+        {
+            delta -= NUSE_Watchdog_Delta[*link];            /* after this entry */
+            link = &NUSE_Watchdog_Next[*link];
+        }
+
+        NUSE_Watchdog_Delta[task] = delta;
+        NUSE_Watchdog_Next[task] = *link;
+        if (*link != NUSE_NO_TASK)
+        {
+            NUSE_Watchdog_Delta[*link] -= delta;            /* following entry is now relative to this one */
+        }
+        *link = task;
+    }
+
+#endif
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Watchdog_Remove()
+*
+*   DESCRIPTION
+*
+*       Takes a task out of the delta list
+*       Must be called in a critical section, with the task in the list
+*
+*   INPUTS
+*
+*       NUSE_TASK task          index of task
+*
+*   RETURNS
+*
+*       (none)
+*
+*   OTHER OUTPUTS
+*
+*       (none)
+*
+*************************************************************************/
+
+#if NUSE_WATCHDOG_SUPPORT
+
+    void NUSE_Watchdog_Remove(NUSE_TASK task)
+    {
+        NUSE_TASK *link;
+
+        link = &NUSE_Watchdog_Head;
+        while (*link != task)
+        {
+            link = &NUSE_Watchdog_Next[*link];
+        }
+
+        *link = NUSE_Watchdog_Next[task];
+        if (*link != NUSE_NO_TASK)
+        {
+            NUSE_Watchdog_Delta[*link] += NUSE_Watchdog_Delta[task];
+        }
+    }
+
+#endif
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Watchdog_Reset()
+*
+*   DESCRIPTION
+*
+*       Default NUSE_WATCHDOG_HANDLER() - called from the clock ISR
+*       Resets the specified task and restarts it
+*       A task which was interrupted by the clock ISR cannot be reset until its
+*       context has been saved, so it is suspended now and the reset is completed
+*       by NUSE_Watchdog_Restart() on the next tick
+*
+*   INPUTS
+*
+*       NUSE_TASK task          index of task which missed its check-in
+*
+*   RETURNS
+*
+*       (none)
+*
+*   OTHER OUTPUTS
+*
+*       (none)
+*
+*************************************************************************/
+
+#if NUSE_WATCHDOG_SUPPORT
+
+    void NUSE_Watchdog_Reset(NUSE_TASK task)
+    {
+        if (task == NUSE_Task_Active)
+        {
+            NUSE_Suspend_Task(task, NUSE_PURE_SUSPEND);     /* swapped out when the ISR completes */
+            NUSE_Watchdog_Reset_Pending |= (U16)1 << task;
+        }
+        else
+        {
+            NUSE_Task_Reset(task);
+            NUSE_Wake_Task(task);
+        }
+    }
+
+#endif
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       NUSE_Watchdog_Restart()
+*
+*   DESCRIPTION
+*
+*       Called from the clock ISR to complete the resets begun by NUSE_Watchdog_Reset()
+*       for tasks which have since been swapped out
+*
+*   INPUTS
+*
+*       (none)
+*
+*   RETURNS
+*
+*       (none)
+*
+*   OTHER OUTPUTS
+*
+*       (none)
+*
+*************************************************************************/
+
+#if NUSE_WATCHDOG_SUPPORT
+
+    void NUSE_Watchdog_Restart(void)
+    {
+        NUSE_TASK task;
+
+        for (task=0; task<NUSE_TASK_NUMBER; task++)
+        {
+            if ((NUSE_Watchdog_Reset_Pending & ((U16)1 << task)) && (task != NUSE_Task_Active))
+            {
+                NUSE_Task_Reset(task);                      /* clears the pending bit */
+                NUSE_Wake_Task(task);
+            }
+        }
+    }
+
+#endif
@@ -0,0 +1,208 @@
+/*** Host scaling benchmark plotter ***/
+
+/************************************************************************
+*
+*   This is a host program [not part of the Nucleus SE kernel] which
+*   plots the results of the scaling benchmark [benchmark/scaling]
+*
+*   The bench_results[] text from each run should be saved and the runs
+*   concatenated into one file [benchmark/scaling/sweep.sh does this], then:
+*
+*       nuse_scaling_plot [-x tasks|timers|partitions] [-d] test file
+*
+*   For each run of the named test [reschedule, wake, tick, allocate or
+*   deallocate] the cost per operation is plotted against the chosen
+*   parameter [default tasks], as a bar chart on the terminal
+*   -d writes two plain columns instead, for gnuplot or a spreadsheet
+*   Runs should vary only the chosen parameter; where the same value
+*   appears more than once, the last run is used
+*
+************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_VALUE (65535)                  /* largest parameter value */
+#define BAR_WIDTH (60)                     /* characters for the longest bar */
+
+static double Cost[MAX_VALUE + 1];
+static int Seen[MAX_VALUE + 1];
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       Results_Read()
+*
+*   DESCRIPTION
+*
+*       Reads the benchmark results and records the cost per operation of
+*       the named test against the chosen parameter
+*       Lines which are not results [such as the output of other programs]
+*       are ignored
+*
+*   INPUTS
+*
+*       FILE *file              results file
+*       const char *test        name of test to be plotted
+*       int column              parameter - 0 tasks, 1 timers, 2 partitions
+*
+*   RETURNS
+*
+*       int                     number of results found
+*
+*************************************************************************/
+
+static int Results_Read(FILE *file, const char *test, int column)
+{
+    char line[200], name[40];
+    unsigned long parameter[3], count, cycles;
+    int found = 0;
+
+    while (fgets(line, sizeof(line), file) != NULL)
+    {
+        if (sscanf(line, "%lu,%lu,%lu,%39[^,],%lu,%lu", &parameter[0], &parameter[1], &parameter[2],
+                   name, &count, &cycles) != 6)
+        {
+            continue;
+        }
+
+        if ((strcmp(name, test) != 0) || (count == 0) || (parameter[column] > MAX_VALUE))
+        {
+            continue;
+        }
+
+        Cost[parameter[column]] = (double)cycles / count;
+        Seen[parameter[column]] = 1;
+        found++;
+    }
+
+    return found;
+}
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       Results_Plot()
+*
+*   DESCRIPTION
+*
+*       Writes the recorded costs in parameter order, either as a bar
+*       chart or as plain data columns
+*
+*   INPUTS
+*
+*       const char *axis        name of the parameter
+*       int data                non-zero for plain data columns
+*
+*   RETURNS
+*
+*       (none)
+*
+*************************************************************************/
+
+static void Results_Plot(const char *axis, int data)
+{
+    double largest = 0.0;
+    unsigned value;
+    int bar, length;
+
+    for (value=0; value<=MAX_VALUE; value++)
+    {
+        if (Seen[value] && (Cost[value] > largest))
+        {
+            largest = Cost[value];
+        }
+    }
+
+    if (!data)
+    {
+        printf("%10s  %12s\n", axis, "cycles/op");
+    }
+
+    for (value=0; value<=MAX_VALUE; value++)
+    {
+        if (!Seen[value])
+        {
+            continue;
+        }
+
+        if (data)
+        {
+            printf("%u %.2f\n", value, Cost[value]);
+            continue;
+        }
+
+        length = (largest > 0.0) ? (int)(Cost[value] * BAR_WIDTH / largest + 0.5) : 0;
+        printf("%10u  %12.2f  ", value, Cost[value]);
+        for (bar=0; bar<length; bar++)
+        {
+            putchar('#');
+        }
+        putchar('\n');
+    }
+}
+
+
+int main(int argc, char *argv[])
+{
+    static const char *Axis_Name[3] = { "tasks", "timers", "partitions" };
+    FILE *file;
+    int column = 0, data = 0, arg = 1;
+
+    while ((argc > arg) && (argv[arg][0] == '-'))
+    {
+        if ((strcmp(argv[arg], "-x") == 0) && (argc > arg + 1))
+        {
+            arg++;
+            for (column=0; column<3; column++)
+            {
+                if (strcmp(argv[arg], Axis_Name[column]) == 0)
+                {
+                    break;
+                }
+            }
+            if (column == 3)
+            {
+                break;
+            }
+        }
+        else if (strcmp(argv[arg], "-d") == 0)
+        {
+            data = 1;
+        }
+        else
+        {
+            break;
+        }
+        arg++;
+    }
+
+    if ((argc != arg + 2) || (column == 3))
+    {
+        fprintf(stderr, "usage: nuse_scaling_plot [-x tasks|timers|partitions] [-d] test file\n");
+        return 1;
+    }
+
+    file = fopen(argv[arg + 1], "r");
+    if (file == NULL)
+    {
+        fprintf(stderr, "nuse_scaling_plot: cannot open %s\n", argv[arg + 1]);
+        return 1;
+    }
+
+    if (Results_Read(file, argv[arg], column) == 0)
+    {
+        fprintf(stderr, "nuse_scaling_plot: no results for %s in %s\n", argv[arg], argv[arg + 1]);
+        fclose(file);
+        return 1;
+    }
+    fclose(file);
+
+    Results_Plot(Axis_Name[column], data);
+    return 0;
+}
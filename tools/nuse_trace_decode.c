@@ -0,0 +1,597 @@
+/*** Host trace decoder ***/
+
+/************************************************************************
+*
+*   This is a host program [not part of the Nucleus SE kernel] which
+*   converts the contents of the Nucleus SE trace buffer to text, or to
+*   the Chrome trace event [JSON] format for viewing in chrome://tracing
+*   or the Perfetto UI
+*
+*   The buffer [NUSE_Trace_Buffer - NUSE_TRACE_SIZE records of type U32]
+*   should be saved to a binary file using the debugger, and the value of
+*   NUSE_Trace_Index noted at the same time, then:
+*
+*       nuse_trace_decode [-l] [-j] [-u microseconds] file index
+*
+*   Records are assumed to be big-endian [as on ColdFire]; -l selects
+*   little-endian
+*   -j selects JSON output, with a process for each task - showing when it
+*   was running or waiting, and on which object, and its API service calls -
+*   and one for interrupts and timer expiries
+*   -u gives the time stamp period in microseconds [default 1]
+*   The 16 bit time stamps are extended on the assumption that records are
+*   written more often than the time source wraps around
+*   The API service call names must be kept in step with nuse_trace.h
+*
+************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* event types - as nuse_codes.h */
+
+#define NUSE_TRACE_SWITCH (1)
+#define NUSE_TRACE_WAKE (2)
+#define NUSE_TRACE_SUSPEND (3)
+#define NUSE_TRACE_API_ENTRY (4)
+#define NUSE_TRACE_API_EXIT (5)
+#define NUSE_TRACE_ISR_ENTRY (6)
+#define NUSE_TRACE_ISR_EXIT (7)
+#define NUSE_TRACE_TIMER (8)
+
+#define NUSE_NISR_CONTEXT (2)
+
+#define TASKS (16)
+#define ISR_PROCESS (100)                  /* JSON process id for interrupts */
+#define ISR_NESTING (8)                    /* deepest ISR nesting shown */
+
+typedef struct
+{
+    unsigned long time;             /* extended time stamp */
+    unsigned event;
+    unsigned task;
+    unsigned data;
+} TRACE_RECORD;
+
+/* task status values - as nuse_codes.h, indexed by the low nibble */
+
+static const char *Suspend_Name[16] =
+{
+    "ready",
+    "suspend",
+    "sleep",
+    "mailbox",
+    "queue",
+    "pipe",
+    "semaphore",
+    "event group",
+    "partition pool",
+    "channel",
+    "signals",
+    "finished",
+    "terminated",
+    "multiple",
+    "binary semaphore",
+    "memory pool"
+};
+
+/* API service call identifiers - as nuse_trace.h, from 1 */
+
+static const char *Api_Name[] =
+{
+    "(unknown)",
+    "NUSE_Task_Suspend",
+    "NUSE_Task_Resume",
+    "NUSE_Task_Sleep",
+    "NUSE_Task_Wait_Multiple",
+    "NUSE_Task_Relinquish",
+    "NUSE_Task_Reset",
+    "NUSE_Partition_Allocate",
+    "NUSE_Partition_Allocate_Size",
+    "NUSE_Partition_Deallocate",
+    "NUSE_Partition_Reference",
+    "NUSE_Partition_Send",
+    "NUSE_Memory_Allocate",
+    "NUSE_Memory_Deallocate",
+    "NUSE_Mailbox_Send",
+    "NUSE_Mailbox_Overwrite",
+    "NUSE_Mailbox_Receive",
+    "NUSE_Mailbox_Reset",
+    "NUSE_Queue_Send",
+    "NUSE_Queue_Receive",
+    "NUSE_Queue_Jam",
+    "NUSE_Queue_Broadcast",
+    "NUSE_Queue_Reset",
+    "NUSE_Pipe_Send",
+    "NUSE_Pipe_Receive",
+    "NUSE_Pipe_Jam",
+    "NUSE_Pipe_Broadcast",
+    "NUSE_Pipe_Reset",
+    "NUSE_Channel_Put",
+    "NUSE_Channel_Get",
+    "NUSE_Board_Write",
+    "NUSE_Board_Read",
+    "NUSE_Semaphore_Obtain",
+    "NUSE_Semaphore_Release",
+    "NUSE_Semaphore_Reset",
+    "NUSE_Binary_Semaphore_Obtain",
+    "NUSE_Binary_Semaphore_Release",
+    "NUSE_Event_Group_Set",
+    "NUSE_Event_Group_Retrieve",
+    "NUSE_Signals_Send",
+    "NUSE_Signals_Wait",
+    "NUSE_Timer_Control",
+    "NUSE_Timer_Reset"
+};
+
+#define API_NAMES (sizeof(Api_Name) / sizeof(Api_Name[0]))
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       Trace_Read()
+*
+*   DESCRIPTION
+*
+*       Reads the saved trace buffer and returns the used records, oldest first
+*       The record at [index] modulo the buffer size is the oldest, if the buffer
+*       has wrapped around; unused records [event type 0] are skipped
+*
+*   INPUTS
+*
+*       FILE *file              saved trace buffer
+*       unsigned long index     value of NUSE_Trace_Index when the buffer was saved
+*       int little              non-zero if the records are little-endian
+*       unsigned *count         pointer to storage for the number of records
+*
+*   RETURNS
+*
+*       TRACE_RECORD *          array of records [or NULL if the file could not be read]
+*
+*   OTHER OUTPUTS
+*
+*       unsigned *count         number of records returned
+*
+*************************************************************************/
+
+static TRACE_RECORD *Trace_Read(FILE *file, unsigned long index, int little, unsigned *count)
+{
+    unsigned char *raw;
+    TRACE_RECORD *records;
+    unsigned long length, size, slot, word, previous, high;
+    unsigned entry, used;
+
+    fseek(file, 0, SEEK_END);
+    length = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    size = length / 4;
+    if ((size == 0) || (size & (size - 1)))
+    {
+        return NULL;                                    /* must be a power of 2 records */
+    }
+
+    raw = malloc(length);
+    records = malloc(size * sizeof(TRACE_RECORD));
+    if ((raw == NULL) || (records == NULL) || (fread(raw, 1, length, file) != length))
+    {
+        free(raw);
+        free(records);
+        return NULL;
+    }
+
+    used = 0;
+    previous = 0;
+    high = 0;
+    for (entry=0; entry<size; entry++)
+    {
+        slot = ((index + entry) & (size - 1)) * 4;
+        if (little)
+        {
+            word = raw[slot] | (raw[slot + 1] << 8) | ((unsigned long)raw[slot + 2] << 16) | ((unsigned long)raw[slot + 3] << 24);
+        }
+        else
+        {
+            word = ((unsigned long)raw[slot] << 24) | ((unsigned long)raw[slot + 1] << 16) | (raw[slot + 2] << 8) | raw[slot + 3];
+        }
+
+        if (((word >> 12) & 0x0f) == 0)
+        {
+            continue;                                   /* unused */
+        }
+
+        if (used != 0 && (word >> 16) < previous)
+        {
+            high += 0x10000;                            /* time stamp wrapped around */
+        }
+        previous = word >> 16;
+
+        records[used].time = high + previous;
+        records[used].event = (word >> 12) & 0x0f;
+        records[used].task = (word >> 8) & 0x0f;
+        records[used].data = word & 0xff;
+        used++;
+    }
+
+    free(raw);
+    *count = used;
+    return records;
+}
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       Trace_Print()
+*
+*   DESCRIPTION
+*
+*       Writes one line of text describing a trace record
+*
+*   INPUTS
+*
+*       const TRACE_RECORD *record      record to be described
+*
+*   RETURNS
+*
+*       (none)
+*
+*************************************************************************/
+
+static void Trace_Print(const TRACE_RECORD *record)
+{
+    printf("%10lu  task %2u  ", record->time, record->task);
+
+    switch (record->event)
+    {
+        case NUSE_TRACE_SWITCH:
+            printf("switch      to task %u\n", record->data);
+            break;
+        case NUSE_TRACE_WAKE:
+            printf("wake\n");
+            break;
+        case NUSE_TRACE_SUSPEND:
+            printf("suspend     %s %u\n", Suspend_Name[record->data & 0x0f], record->data >> 4);
+            break;
+        case NUSE_TRACE_API_ENTRY:
+            printf("api entry   %s\n", record->data < API_NAMES ? Api_Name[record->data] : Api_Name[0]);
+            break;
+        case NUSE_TRACE_API_EXIT:
+            printf("api exit    status %d\n", (signed char)record->data);
+            break;
+        case NUSE_TRACE_ISR_ENTRY:
+            printf("isr entry   %s\n", record->data == NUSE_NISR_CONTEXT ? "native" : "managed");
+            break;
+        case NUSE_TRACE_ISR_EXIT:
+            printf("isr exit    %s\n", record->data == NUSE_NISR_CONTEXT ? "native" : "managed");
+            break;
+        case NUSE_TRACE_TIMER:
+            printf("timer       %u expired\n", record->data);
+            break;
+        default:
+            printf("event %u     data 0x%02x\n", record->event, record->data);
+            break;
+    }
+}
+
+
+static int Chrome_First = 1;
+
+/* object index from a suspend code, or ~0 if the task was not waiting on an object */
+
+static unsigned Wait_Index(unsigned code)
+{
+    switch (code & 0x0f)
+    {
+        case 1:                                         /* suspend */
+        case 2:                                         /* sleep */
+        case 11:                                        /* finished */
+        case 12:                                        /* terminated */
+        case 13:                                        /* multiple */
+            return ~0u;
+        default:
+            return code >> 4;
+    }
+}
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       Chrome_Span()
+*
+*   DESCRIPTION
+*
+*       Writes a complete [duration] event in the Chrome trace event format
+*
+*   INPUTS
+*
+*       const char *name        event name
+*       unsigned index          object index, appended to the name unless ~0
+*       unsigned pid            process [task or interrupts]
+*       unsigned tid            thread within the process
+*       unsigned long start     start time stamp
+*       unsigned long end       end time stamp
+*       double scale            microseconds per time stamp unit
+*
+*   RETURNS
+*
+*       (none)
+*
+*************************************************************************/
+
+static void Chrome_Span(const char *name, unsigned index, unsigned pid, unsigned tid,
+                        unsigned long start, unsigned long end, double scale)
+{
+    printf("%s\n  {\"name\":\"%s", Chrome_First ? "" : ",", name);
+    if (index != ~0u)
+    {
+        printf(" %u", index);
+    }
+    printf("\",\"ph\":\"X\",\"pid\":%u,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+           pid, tid, start * scale, (end - start) * scale);
+    Chrome_First = 0;
+}
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       Trace_Chrome()
+*
+*   DESCRIPTION
+*
+*       Writes the trace records in the Chrome trace event format
+*       Each task is a process [id = task index + 1] with two threads: 1 shows
+*       when the task was running or waiting - named after the object type and
+*       index from its suspend record - and 2 shows its API service calls
+*       Interrupts are a separate process, with ISRs on thread 1 and timer
+*       expiries as instant events on thread 2
+*       Spans which are still open at the end of the trace are closed at the
+*       time of the last record
+*
+*   INPUTS
+*
+*       const TRACE_RECORD *records     records, oldest first
+*       unsigned count                  number of records
+*       double scale                    microseconds per time stamp unit
+*
+*   RETURNS
+*
+*       (none)
+*
+*************************************************************************/
+
+static void Trace_Chrome(const TRACE_RECORD *records, unsigned count, double scale)
+{
+    unsigned long run_start[TASKS], wait_start[TASKS], api_start[TASKS], isr_start[ISR_NESTING], last;
+    unsigned wait_code[TASKS], api_id[TASKS];
+    int running[TASKS], waiting[TASKS], in_api[TASKS], seen[TASKS], in_isr = 0;     /* ISR nesting depth */
+    const TRACE_RECORD *record;
+    unsigned entry, task;
+
+    memset(running, 0, sizeof(running));
+    memset(waiting, 0, sizeof(waiting));
+    memset(in_api, 0, sizeof(in_api));
+    memset(seen, 0, sizeof(seen));
+
+    printf("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[");
+
+    for (entry=0; entry<count; entry++)
+    {
+        record = &records[entry];
+        task = record->task;
+        seen[task] = 1;
+
+        switch (record->event)
+        {
+            case NUSE_TRACE_SWITCH:
+                if (record->data == task)
+                {
+                    break;                              /* same task selected again */
+                }
+                if (running[task])
+                {
+                    Chrome_Span("running", ~0u, task + 1, 1, run_start[task], record->time, scale);
+                    running[task] = 0;
+                }
+                task = record->data & (TASKS - 1);
+                seen[task] = 1;
+                if (waiting[task])                      /* made ready without a wake record */
+                {
+                    Chrome_Span(Suspend_Name[wait_code[task] & 0x0f], Wait_Index(wait_code[task]), task + 1, 1,
+                                wait_start[task], record->time, scale);
+                    waiting[task] = 0;
+                }
+                running[task] = 1;
+                run_start[task] = record->time;
+                break;
+
+            case NUSE_TRACE_SUSPEND:
+                if (running[task])
+                {
+                    Chrome_Span("running", ~0u, task + 1, 1, run_start[task], record->time, scale);
+                    running[task] = 0;
+                }
+                waiting[task] = 1;
+                wait_start[task] = record->time;
+                wait_code[task] = record->data;
+                break;
+
+            case NUSE_TRACE_WAKE:
+                if (waiting[task])
+                {
+                    Chrome_Span(Suspend_Name[wait_code[task] & 0x0f], Wait_Index(wait_code[task]), task + 1, 1,
+                                wait_start[task], record->time, scale);
+                    waiting[task] = 0;
+                }
+                break;
+
+            case NUSE_TRACE_API_ENTRY:
+                in_api[task] = 1;
+                api_start[task] = record->time;
+                api_id[task] = record->data < API_NAMES ? record->data : 0;
+                break;
+
+            case NUSE_TRACE_API_EXIT:
+                if (in_api[task])
+                {
+                    Chrome_Span(Api_Name[api_id[task]], ~0u, task + 1, 2, api_start[task], record->time, scale);
+                    in_api[task] = 0;
+                }
+                break;
+
+            case NUSE_TRACE_ISR_ENTRY:
+                if (in_isr < ISR_NESTING)
+                {
+                    isr_start[in_isr] = record->time;
+                }
+                in_isr++;
+                break;
+
+            case NUSE_TRACE_ISR_EXIT:
+                if (in_isr)                             /* innermost ISR */
+                {
+                    in_isr--;
+                    if (in_isr < ISR_NESTING)
+                    {
+                        Chrome_Span(record->data == NUSE_NISR_CONTEXT ? "native ISR" : "managed ISR", ~0u,
+                                    ISR_PROCESS, 1, isr_start[in_isr], record->time, scale);
+                    }
+                }
+                break;
+
+            case NUSE_TRACE_TIMER:
+                printf("%s\n  {\"name\":\"timer %u\",\"ph\":\"i\",\"s\":\"t\",\"pid\":%u,\"tid\":2,\"ts\":%.3f}",
+                       Chrome_First ? "" : ",", record->data, ISR_PROCESS, record->time * scale);
+                Chrome_First = 0;
+                break;
+        }
+    }
+
+    last = count ? records[count - 1].time : 0;
+    for (task=0; task<TASKS; task++)
+    {
+        if (running[task])
+        {
+            Chrome_Span("running", ~0u, task + 1, 1, run_start[task], last, scale);
+        }
+        if (waiting[task])
+        {
+            Chrome_Span(Suspend_Name[wait_code[task] & 0x0f], Wait_Index(wait_code[task]), task + 1, 1,
+                        wait_start[task], last, scale);
+        }
+        if (in_api[task])
+        {
+            Chrome_Span(Api_Name[api_id[task]], ~0u, task + 1, 2, api_start[task], last, scale);
+        }
+        if (seen[task])
+        {
+            printf("%s\n  {\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%u,\"args\":{\"name\":\"task %u\"}}",
+                   Chrome_First ? "" : ",", task + 1, task);
+            Chrome_First = 0;
+            printf(",\n  {\"name\":\"process_sort_index\",\"ph\":\"M\",\"pid\":%u,\"args\":{\"sort_index\":%u}}", task + 1, task);
+            printf(",\n  {\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%u,\"tid\":1,\"args\":{\"name\":\"state\"}}", task + 1);
+            printf(",\n  {\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%u,\"tid\":2,\"args\":{\"name\":\"API calls\"}}", task + 1);
+        }
+    }
+    while (in_isr)
+    {
+        in_isr--;
+        if (in_isr < ISR_NESTING)
+        {
+            Chrome_Span("ISR", ~0u, ISR_PROCESS, 1, isr_start[in_isr], last, scale);
+        }
+    }
+
+    printf("%s\n  {\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%u,\"args\":{\"name\":\"interrupts\"}}",
+           Chrome_First ? "" : ",", ISR_PROCESS);
+    printf(",\n  {\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%u,\"tid\":1,\"args\":{\"name\":\"ISRs\"}}", ISR_PROCESS);
+    printf(",\n  {\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%u,\"tid\":2,\"args\":{\"name\":\"timers\"}}", ISR_PROCESS);
+    printf("\n]}\n");
+}
+
+
+/*************************************************************************
+*
+*   FUNCTION
+*
+*       main()
+*
+*   DESCRIPTION
+*
+*       Reads the saved trace buffer named on the command line and writes
+*       a description of each record, or the JSON trace, to the standard output
+*
+*************************************************************************/
+
+int main(int argc, char *argv[])
+{
+    FILE *file;
+    TRACE_RECORD *records;
+    unsigned count, entry;
+    int little = 0, json = 0, arg = 1;
+    double scale = 1.0;
+
+    while ((argc > arg) && (argv[arg][0] == '-'))
+    {
+        if (strcmp(argv[arg], "-l") == 0)
+        {
+            little = 1;
+        }
+        else if (strcmp(argv[arg], "-j") == 0)
+        {
+            json = 1;
+        }
+        else if ((strcmp(argv[arg], "-u") == 0) && (argc > arg + 1))
+        {
+            scale = atof(argv[++arg]);
+        }
+        else
+        {
+            break;
+        }
+        arg++;
+    }
+
+    if (argc != arg + 2)
+    {
+        fprintf(stderr, "usage: nuse_trace_decode [-l] [-j] [-u microseconds] file index\n");
+        return 1;
+    }
+
+    file = fopen(argv[arg], "rb");
+    if (file == NULL)
+    {
+        fprintf(stderr, "nuse_trace_decode: cannot open %s\n", argv[arg]);
+        return 1;
+    }
+
+    records = Trace_Read(file, strtoul(argv[arg + 1], NULL, 0), little, &count);
+    fclose(file);
+    if (records == NULL)
+    {
+        fprintf(stderr, "nuse_trace_decode: %s is not a valid trace buffer\n", argv[arg]);
+        return 1;
+    }
+
+    if (json)
+    {
+        Trace_Chrome(records, count, scale);
+    }
+    else
+    {
+        for (entry=0; entry<count; entry++)
+        {
+            Trace_Print(&records[entry]);
+        }
+    }
+
+    free(records);
+    return 0;
+}